@@ -108,6 +108,50 @@
   typedef SchedulerState_t xSchedulerState;
 
 
+  /**
+   * @brief Enumerated type for task release policies
+   *
+   * The release policy of a task decides when its task timer elapses next after
+   * the scheduler runs the task because its task timer elapsed. The release
+   * policy of a task is changed by calling xTaskChangeReleasePolicy(). Tasks
+   * are created with the TaskReleasePolicyRelative release policy.
+   *
+   * @sa xTaskReleasePolicy
+   * @sa xTaskChangeReleasePolicy()
+   * @sa xTaskGetReleasePolicy()
+   * @sa xTaskChangePeriod()
+   *
+   */
+  typedef enum TaskReleasePolicy_e {
+    TaskReleasePolicyRelative,
+
+
+    /**< The task timer period starts over when the scheduler runs the task.
+     * The time it took the scheduler to get to the task is added to every
+     * period so the task drifts. This is the release policy tasks are created
+     * with. */
+    TaskReleasePolicyCatchUp,
+
+
+    /**< The task timer period starts where the last one ended so the task does
+     * not drift. If the task falls more than a period behind, the scheduler
+     * runs it back to back until it has caught up. */
+    TaskReleasePolicySkip /**< The task timer period starts where the last one
+                           * ended so the task does not drift. If the task
+                           * falls more than a period behind, the periods it
+                           * missed are skipped. */
+  } TaskReleasePolicy_t;
+
+
+  /**
+   * @brief Enumerated type for task release policies
+   *
+   * @sa TaskReleasePolicy_t
+   *
+   */
+  typedef TaskReleasePolicy_t xTaskReleasePolicy;
+
+
   /**
    * @brief Enumerated type for syscall return type
    *
@@ -302,12 +346,19 @@
    * The Ticks_t type is used to store ticks from the system clock. Ticks is not
    * bound to any one unit of measure for time though most systems are
    * configured for millisecond resolution, milliseconds is not guaranteed and
-   * is dependent on the system clock frequency and prescaler.
+   * is dependent on the system clock frequency and prescaler. Ticks_t is 32
+   * bits wide unless CONFIG_TICKS_64BIT_ENABLE is defined.
    *
    * @sa xTicks
+   * @sa CONFIG_TICK_RESOLUTION
+   * @sa CONFIG_TICKS_64BIT_ENABLE
    *
    */
-  typedef UINT32_TYPE Ticks_t;
+  #if defined(CONFIG_TICKS_64BIT_ENABLE)
+    typedef UINT64_TYPE Ticks_t;
+  #else  /* if defined(CONFIG_TICKS_64BIT_ENABLE) */
+    typedef UINT32_TYPE Ticks_t;
+  #endif /* if defined(CONFIG_TICKS_64BIT_ENABLE) */
 
 
   /**
@@ -478,6 +529,22 @@
                           */
     Ticks_t totalRunTime; /**< The duration in ticks of the task's total
                            * runtime. */
+    Word_t deadlineMisses; /**< The number of times the task finished after
+                            * the end of its task timer period. This and the
+                            * release statistics below are zero unless
+                            * CONFIG_TASK_RELEASE_STATS_ENABLE is defined. */
+    Word_t releases; /**< The number of times the task was run because its task
+                      * timer elapsed. */
+    Word_t overruns; /**< The number of times the task fell more than a task
+                      * timer period behind. For the TaskReleasePolicySkip
+                      * release policy, this is the number of periods that were
+                      * skipped. */
+    Ticks_t maximumReleaseJitter; /**< The longest time in ticks between the
+                                   * task timer elapsing and the task being
+                                   * run. */
+    Ticks_t totalReleaseJitter; /**< The sum of the times in ticks between the
+                                 * task timer elapsing and the task being run.
+                                 * Divide by releases for the average. */
   } TaskRunTimeStats_t;
 
 
@@ -525,6 +592,295 @@
   typedef MemoryRegionStats_t *xMemoryRegionStats;
 
 
+  /**
+   * @brief Enumerated type for memory regions
+   *
+   * The MemoryRegionId_t enumerated data type is used to select the memory
+   * region operated on by syscalls which are not specific to either the heap or
+   * kernel memory region such as xMemGetRegionMap().
+   *
+   * @sa xMemoryRegionId
+   * @sa xMemGetRegionMap()
+   *
+   */
+  typedef enum MemoryRegionId_e {
+    MemoryRegionHeap, /**< The heap memory region used by xMemAlloc() and
+                       * xMemFree(). */
+    MemoryRegionKernel /**< The kernel memory region used solely by the kernel
+                        * for kernel objects. */
+  } MemoryRegionId_t;
+
+
+  /**
+   * @brief Enumerated type for memory regions
+   *
+   * @sa MemoryRegionId_t
+   *
+   */
+  typedef MemoryRegionId_t xMemoryRegionId;
+
+
+  /**
+   * @brief Enumerated type for critical sections
+   *
+   * The CriticalSite_t enumerated data type identifies the places in the kernel
+   * where interrupts are disabled. It is used by
+   * xSystemGetCriticalSectionStats() to select which critical section to
+   * obtain statistics for.
+   *
+   * @sa xCriticalSite
+   * @sa xSystemGetCriticalSectionStats()
+   * @sa CONFIG_CRITICAL_SECTION_STATS_ENABLE
+   *
+   */
+  typedef enum CriticalSite_e {
+    CriticalSiteMemAlloc, /**< Committing an allocation from the heap or kernel
+                           * memory region. */
+    CriticalSiteMemFree, /**< Committing a free to the heap or kernel memory
+                          * region. */
+    CriticalSiteBuddyAlloc, /**< Allocating from the buddy memory region. */
+    CriticalSiteBuddyFree, /**< Freeing to the buddy memory region. */
+    CriticalSitePortTick, /**< Counting a system tick in the port layer. */
+    CriticalSiteTaskNotify /**< Giving or taking a counting or bitwise
+                            * direct-to-task notification. */
+  } CriticalSite_t;
+
+
+  /**
+   * @brief Enumerated type for critical sections
+   *
+   * @sa CriticalSite_t
+   *
+   */
+  typedef CriticalSite_t xCriticalSite;
+
+
+  /**
+   * @brief Enumerated type for task histograms
+   *
+   * The TaskHistogramId_t enumerated data type selects which of a task's
+   * histograms xTaskGetLatencyHistogram() obtains.
+   *
+   * @sa xTaskHistogramId
+   * @sa xTaskGetLatencyHistogram()
+   * @sa CONFIG_TASK_HISTOGRAM_ENABLE
+   *
+   */
+  typedef enum TaskHistogramId_e {
+    TaskHistogramRunTime, /**< How long the task's main function ran for each
+                           * time it was called. */
+    TaskHistogramWakeLatency /**< How long after a waiting task was due to run,
+                              * because its task timer elapsed or it was given
+                              * a notification, the task was run. */
+  } TaskHistogramId_t;
+
+
+  /**
+   * @brief Enumerated type for task histograms
+   *
+   * @sa TaskHistogramId_t
+   *
+   */
+  typedef TaskHistogramId_t xTaskHistogramId;
+
+
+  /**
+   * @brief Enumerated type for scheduler trace events
+   *
+   * The TraceEventType_t enumerated data type says what happened in a
+   * TraceEvent_t recorded by the scheduler event trace.
+   *
+   * @sa xTraceEventType
+   * @sa xTaskGetTrace()
+   * @sa CONFIG_TRACE_ENABLE
+   *
+   */
+  typedef enum TraceEventType_e {
+    TraceEventDispatchStart, /**< The scheduler called the task's main
+                              * function. */
+    TraceEventDispatchEnd, /**< The task's main function returned to the
+                            * scheduler. */
+    TraceEventWakePeriod, /**< The waiting task is about to be run because its
+                           * task timer elapsed. */
+    TraceEventWakeNotification, /**< The waiting task is about to be run
+                                 * because it was given a notification. */
+    TraceEventSuspend, /**< The task was suspended by xTaskSuspend(). */
+    TraceEventResume, /**< The task was resumed by xTaskResume(). */
+    TraceEventWDSuspend, /**< The task was suspended because its last runtime
+                          * exceeded its task watchdog timer period. */
+    TraceEventWakeAwait /**< The waiting task is about to be run because the
+                         * message queue or stream buffer it awaits may be
+                         * ready. */
+  } TraceEventType_t;
+
+
+  /**
+   * @brief Enumerated type for scheduler trace events
+   *
+   * @sa TraceEventType_t
+   *
+   */
+  typedef TraceEventType_t xTraceEventType;
+
+
+  /**
+   * @brief Enumerated type for kernel objects with caller-owned storage
+   *
+   * The StaticObject_t enumerated data type selects the kind of kernel object
+   * xSystemGetStaticSize() returns the storage size for.
+   *
+   * @sa xStaticObject
+   * @sa xSystemGetStaticSize()
+   *
+   */
+  typedef enum StaticObject_e {
+    StaticObjectTask, /**< A task created by xTaskCreateStatic(). */
+    StaticObjectQueue, /**< A message queue created by xQueueCreateStatic(). */
+    StaticObjectTimer, /**< An application timer created by
+                        * xTimerCreateStatic(). */
+    StaticObjectStream /**< A stream buffer created by xStreamCreateStatic(). */
+  } StaticObject_t;
+
+
+  /**
+   * @brief Enumerated type for kernel objects with caller-owned storage
+   *
+   * @sa StaticObject_t
+   *
+   */
+  typedef StaticObject_t xStaticObject;
+
+
+  /**
+   * @brief Data structure for a memory region map entry
+   *
+   * The MemoryRegionMapEntry_t data structure describes a single memory entry
+   * in a memory region and is used by xMemGetRegionMap() to obtain the layout
+   * of a memory region. Both the offset and blocks members are expressed in
+   * blocks. See CONFIG_MEMORY_REGION_BLOCK_SIZE for block size in bytes.
+   *
+   * @sa xMemoryRegionMapEntry
+   * @sa xMemGetRegionMap()
+   * @sa CONFIG_MEMORY_REGION_BLOCK_SIZE
+   *
+   */
+  typedef struct MemoryRegionMapEntry_s {
+    HalfWord_t offset; /**< The offset, in blocks, of the memory entry from the
+                        * start of the memory region. */
+    HalfWord_t blocks; /**< The number of blocks, including the blocks used by
+                        * the memory entry itself, contained in the memory
+                        * entry. */
+    Base_t free; /**< True if the memory entry is free, false if it is in-use.
+                  */
+  } MemoryRegionMapEntry_t;
+
+
+  /**
+   * @brief Data structure for a memory region map entry
+   *
+   */
+  typedef MemoryRegionMapEntry_t *xMemoryRegionMapEntry;
+
+
+  /**
+   * @brief Data structure for critical section statistics
+   *
+   * The CriticalSectionStats_t data structure contains statistics about how
+   * long interrupts were disabled at a single critical section. Durations are
+   * measured in the units of the port's timestamp (microseconds on Arduino,
+   * CPU cycles on ARM Cortex-M and nanoseconds on POSIX). Bucket i of the
+   * histogram counts critical sections that lasted at least 2^i but less than
+   * 2^(i+1) units, except for the first bucket which also counts durations of
+   * zero and the last bucket which also counts anything longer.
+   *
+   * @sa xCriticalSectionStats
+   * @sa xSystemGetCriticalSectionStats()
+   * @sa CONFIG_CRITICAL_SECTION_STATS_ENABLE
+   *
+   */
+  typedef struct CriticalSectionStats_s {
+    Word_t count; /**< The number of times the critical section was entered. */
+    Word_t maximum; /**< The longest time interrupts were disabled at the
+                     * critical section. */
+    Word_t histogram[CRITICAL_SECTION_HISTOGRAM_BUCKETS]; /**< Log2 histogram
+                                                           * of the time
+                                                           * interrupts were
+                                                           * disabled. */
+  } CriticalSectionStats_t;
+
+
+  /**
+   * @brief Data structure for critical section statistics
+   *
+   * @sa CriticalSectionStats_t
+   *
+   */
+  typedef CriticalSectionStats_t *xCriticalSectionStats;
+
+
+  /**
+   * @brief Data structure for a task latency histogram
+   *
+   * The TaskHistogram_t data structure contains a log2 histogram of either the
+   * runtime or the wake latency of a task as selected by TaskHistogramId_t.
+   * Times are in ticks. Bucket i of the histogram counts times of at least 2^i
+   * but less than 2^(i+1) ticks, except for the first bucket which also counts
+   * times of zero and the last bucket which also counts anything longer. The
+   * 99th percentile is worked out from the histogram so it is the upper bound
+   * of the bucket it falls in, or the maximum if that is less.
+   *
+   * @sa xTaskHistogram
+   * @sa xTaskGetLatencyHistogram()
+   * @sa CONFIG_TASK_HISTOGRAM_ENABLE
+   *
+   */
+  typedef struct TaskHistogram_s {
+    Word_t count; /**< The number of times recorded in the histogram. */
+    Ticks_t maximum; /**< The longest time recorded in the histogram. */
+    Ticks_t percentile99; /**< The time 99 percent of the recorded times did
+                           * not exceed. */
+    Word_t histogram[TASK_HISTOGRAM_BUCKETS]; /**< Log2 histogram of the
+                                               * recorded times. */
+  } TaskHistogram_t;
+
+
+  /**
+   * @brief Data structure for a task latency histogram
+   *
+   * @sa TaskHistogram_t
+   *
+   */
+  typedef TaskHistogram_t *xTaskHistogram;
+
+
+  /**
+   * @brief Data structure for a scheduler trace event
+   *
+   * The TraceEvent_t data structure is a single event recorded by the
+   * scheduler event trace. The event member is kept in a single byte to keep
+   * the trace buffer small and holds one of the TraceEventType_t values.
+   *
+   * @sa xTraceEvent
+   * @sa xTaskGetTrace()
+   * @sa CONFIG_TRACE_ENABLE
+   *
+   */
+  typedef struct TraceEvent_s {
+    Ticks_t time; /**< The time, in ticks, the event was recorded. */
+    Base_t id; /**< The ID of the task the event is about. */
+    Base_t event; /**< What happened, one of the TraceEventType_t values. */
+  } TraceEvent_t;
+
+
+  /**
+   * @brief Data structure for a scheduler trace event
+   *
+   * @sa TraceEvent_t
+   *
+   */
+  typedef TraceEvent_t *xTraceEvent;
+
+
   /**
    * @brief Data structure for information about a task
    *
@@ -539,6 +895,7 @@
    * @sa xTaskGetTaskInfo()
    * @sa xTaskGetAllTaskInfo()
    * @sa CONFIG_TASK_NAME_BYTES
+   * @sa CONFIG_TASK_UTILIZATION_ENABLE
    * @sa xMemFree()
    *
    */
@@ -554,6 +911,10 @@
                           */
     Ticks_t totalRunTime; /**< The duration in ticks of the task's total
                            * runtime. */
+    HalfWord_t utilization; /**< The share of the CPU, in tenths of a percent,
+                             * the task used over the utilization window. Zero
+                             * unless CONFIG_TASK_UTILIZATION_ENABLE is
+                             * defined. */
   } TaskInfo_t;
 
 
@@ -1088,6 +1449,85 @@
   xReturn xMemGetKernelStats(xMemoryRegionStats *stats_);
 
 
+  /**
+   * @brief Syscall to get memory statistics on the buddy memory region
+   *
+   * The xMemGetBuddyStats() syscall is used to obtain detailed statistics
+   * about the buddy memory region which can be used by the application to
+   * monitor how device buffers are using the buddy memory region. Because the
+   * buddy memory region only hands out power of two blocks, the free entry
+   * sizes reported are always a power of two multiple of the smallest buddy
+   * block and the number of free blocks is counted in smallest buddy blocks.
+   * xMemGetBuddyStats() returns ReturnError unless
+   * CONFIG_MEMORY_BUDDY_REGION_ENABLE is defined.
+   *
+   * @sa xReturn
+   * @sa xMemoryRegionStats
+   * @sa xMemFree()
+   * @sa CONFIG_MEMORY_BUDDY_REGION_ENABLE
+   *
+   * @param  stats_ The memory region statistics. The memory region statistics
+   *                must be freed by xMemFree().
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xMemGetBuddyStats(xMemoryRegionStats *stats_);
+
+
+  /**
+   * @brief Syscall to get the layout of a memory region
+   *
+   * The xMemGetRegionMap() syscall copies the offset, size and state of each
+   * memory entry in the heap or kernel memory region into a buffer supplied by
+   * the caller. Unlike xMemGetHeapStats() and xMemGetKernelStats(), which only
+   * report aggregate statistics, the map shows the actual layout of the memory
+   * region and can be used to study fragmentation. Because the map is copied
+   * into the caller's buffer, xMemGetRegionMap() does not allocate heap memory
+   * and does not change the layout it is capturing. The map can be rendered
+   * and analyzed on a host with the memmap tool found in /test/tools.
+   *
+   * @sa xReturn
+   * @sa xMemoryRegionId
+   * @sa xMemoryRegionMapEntry
+   * @sa xMemGetHeapStats()
+   * @sa xMemGetKernelStats()
+   *
+   * @param  region_  The memory region to map, either MemoryRegionHeap or
+   *                  MemoryRegionKernel.
+   * @param  map_     The buffer, owned by the caller, that the map is copied
+   *                  into.
+   * @param  size_    The number of map entries the buffer can hold.
+   * @param  entries_ The number of memory entries in the memory region. If
+   *                  entries_ is greater than size_, only the first size_
+   *                  memory entries were copied into the buffer.
+   * @return          On success, the syscall returns ReturnOK. On failure, the
+   *                  syscall returns ReturnError. A failure is any condition in
+   *                  which the syscall was unable to achieve its intended
+   *                  objective. For example, if xTaskGetId() was unable to
+   *                  locate the task by the task object (i.e., xTask) passed to
+   *                  the syscall, because either the object was null or invalid
+   *                  (e.g., a deleted task), xTaskGetId() would return
+   *                  ReturnError. All HeliOS syscalls return the xReturn
+   *                  (a.k.a., Return_t) type which can either be ReturnOK or
+   *                  ReturnError. The C macros OK() and ERROR() can be used as
+   *                  a more concise way of checking the return value of a
+   *                  syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                  if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xMemGetRegionMap(const xMemoryRegionId region_, xMemoryRegionMapEntry map_, const xHalfWord size_, xHalfWord *entries_);
+
+
   /**
    * @brief Syscall to create a message queue
    *
@@ -1121,6 +1561,50 @@
   xReturn xQueueCreate(xQueue *queue_, const xBase limit_);
 
 
+  /**
+   * @brief Syscall to create a message queue in caller-owned storage
+   *
+   * The xQueueCreateStatic() syscall is the same as xQueueCreate() except the
+   * message queue is placed in storage owned by the caller instead of being
+   * allocated from the kernel memory region. Once created, the message queue
+   * is used and deleted like any other. Deleting it does not free the storage,
+   * it only means the storage can be used again. The messages in a message
+   * queue are still allocated from the kernel memory region when they are
+   * sent.
+   *
+   * @sa xReturn
+   * @sa xQueue
+   * @sa xQueueCreate()
+   * @sa xQueueDelete()
+   * @sa xSystemGetStaticSize()
+   *
+   * @param  queue_   The message queue to be operated on.
+   * @param  storage_ Caller-owned storage for the message queue, which must
+   *                  stay valid until the message queue is deleted. It does not
+   *                  need to be aligned.
+   * @param  bytes_   The size of the storage in bytes. It must be at least the
+   *                  size returned by xSystemGetStaticSize() for
+   *                  StaticObjectQueue.
+   * @param  limit_   The message limit for the queue. The minimum message limit
+   *                  is configured using the CONFIG_QUEUE_MINIMUM_LIMIT
+   *                  (default is 5) setting.
+   * @return          On success, the syscall returns ReturnOK. On failure, the
+   *                  syscall returns ReturnError. A failure is any condition in
+   *                  which the syscall was unable to achieve its intended
+   *                  objective. For example, if xTaskGetId() was unable to
+   *                  locate the task by the task object (i.e., xTask) passed to
+   *                  the syscall, because either the object was null or invalid
+   *                  (e.g., a deleted task), xTaskGetId() would return
+   *                  ReturnError. All HeliOS syscalls return the xReturn
+   *                  (a.k.a., Return_t) type which can either be ReturnOK or
+   *                  ReturnError. The C macros OK() and ERROR() can be used as
+   *                  a more concise way of checking the return value of a
+   *                  syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                  if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xQueueCreateStatic(xQueue *queue_, xByte *storage_, const xSize bytes_, const xBase limit_);
+
+
   /**
    * @brief Syscall to delete a message queue
    *
@@ -1397,6 +1881,45 @@
   xReturn xQueueReceive(xQueue queue_, xQueueMessage *message_);
 
 
+  /**
+   * @brief Syscall to block until a message can be received from a message queue
+   *
+   * The xQueueReceiveBlocking() syscall is the same as xQueueReceive() except,
+   * if the message queue is empty, it blocks the stackful task that called it
+   * until a message has been sent to the message queue. While it is blocked,
+   * the task is in the waiting state and the scheduler runs the other tasks.
+   * xQueueReceiveBlocking() may only be called from a task created by
+   * xTaskCreateStackful(). CONFIG_TASK_STACKFUL_ENABLE must be defined to use
+   * xQueueReceiveBlocking().
+   *
+   * @sa xReturn
+   * @sa xQueue
+   * @sa xQueueMessage
+   * @sa xQueueReceive()
+   * @sa xTaskCreateStackful()
+   * @sa xMemFree()
+   * @sa CONFIG_TASK_STACKFUL_ENABLE
+   *
+   * @param  queue_   The message queue to be operated on.
+   * @param  message_ The message retrieved from the message queue. The message
+   *                  must be freed by xMemFree().
+   * @return          On success, the syscall returns ReturnOK. On failure, the
+   *                  syscall returns ReturnError. A failure is any condition in
+   *                  which the syscall was unable to achieve its intended
+   *                  objective. For example, if xTaskGetId() was unable to
+   *                  locate the task by the task object (i.e., xTask) passed to
+   *                  the syscall, because either the object was null or invalid
+   *                  (e.g., a deleted task), xTaskGetId() would return
+   *                  ReturnError. All HeliOS syscalls return the xReturn
+   *                  (a.k.a., Return_t) type which can either be ReturnOK or
+   *                  ReturnError. The C macros OK() and ERROR() can be used as
+   *                  a more concise way of checking the return value of a
+   *                  syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                  if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xQueueReceiveBlocking(xQueue queue_, xQueueMessage *message_);
+
+
   /**
    * @brief Syscall to lock a message queue
    *
@@ -1486,32 +2009,71 @@
 
 
   /**
-   * @brief Syscall to delete a stream buffer
+   * @brief Syscall to create a stream buffer in caller-owned storage
    *
-   * The xStreamDelete() syscall is used to delete a stream buffer created by
-   * xStreamCreate().
+   * The xStreamCreateStatic() syscall is the same as xStreamCreate() except
+   * the stream buffer is placed in storage owned by the caller instead of
+   * being allocated from the kernel memory region. Once created, the stream
+   * buffer is used and deleted like any other. Deleting it does not free the
+   * storage, it only means the storage can be used again.
    *
    * @sa xReturn
    * @sa xStreamBuffer
    * @sa xStreamCreate()
-   *
-   * @param  stream_ The stream buffer to be operated on.
-   * @return         On success, the syscall returns ReturnOK. On failure, the
-   *                 syscall returns ReturnError. A failure is any condition in
-   *                 which the syscall was unable to achieve its intended
-   *                 objective. For example, if xTaskGetId() was unable to
-   *                 locate the task by the task object (i.e., xTask) passed to
-   *                 the syscall, because either the object was null or invalid
-   *                 (e.g., a deleted task), xTaskGetId() would return
-   *                 ReturnError. All HeliOS syscalls return the xReturn
-   *                 (a.k.a., Return_t) type which can either be ReturnOK or
-   *                 ReturnError. The C macros OK() and ERROR() can be used as a
-   *                 more concise way of checking the return value of a syscall
-   *                 (e.g., if(OK(xMemGetUsed(&size))) {} or
-   *                 if(ERROR(xMemGetUsed(&size))) {}).
-   */
-  xReturn xStreamDelete(const xStreamBuffer stream_);
-
+   * @sa xStreamDelete()
+   * @sa xSystemGetStaticSize()
+   *
+   * @param  stream_  The stream buffer to be operated on.
+   * @param  storage_ Caller-owned storage for the stream buffer, which must
+   *                  stay valid until the stream buffer is deleted. It does not
+   *                  need to be aligned.
+   * @param  bytes_   The size of the storage in bytes. It must be at least the
+   *                  size returned by xSystemGetStaticSize() for
+   *                  StaticObjectStream.
+   * @return          On success, the syscall returns ReturnOK. On failure, the
+   *                  syscall returns ReturnError. A failure is any condition in
+   *                  which the syscall was unable to achieve its intended
+   *                  objective. For example, if xTaskGetId() was unable to
+   *                  locate the task by the task object (i.e., xTask) passed to
+   *                  the syscall, because either the object was null or invalid
+   *                  (e.g., a deleted task), xTaskGetId() would return
+   *                  ReturnError. All HeliOS syscalls return the xReturn
+   *                  (a.k.a., Return_t) type which can either be ReturnOK or
+   *                  ReturnError. The C macros OK() and ERROR() can be used as
+   *                  a more concise way of checking the return value of a
+   *                  syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                  if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xStreamCreateStatic(xStreamBuffer *stream_, xByte *storage_, const xSize bytes_);
+
+
+  /**
+   * @brief Syscall to delete a stream buffer
+   *
+   * The xStreamDelete() syscall is used to delete a stream buffer created by
+   * xStreamCreate().
+   *
+   * @sa xReturn
+   * @sa xStreamBuffer
+   * @sa xStreamCreate()
+   *
+   * @param  stream_ The stream buffer to be operated on.
+   * @return         On success, the syscall returns ReturnOK. On failure, the
+   *                 syscall returns ReturnError. A failure is any condition in
+   *                 which the syscall was unable to achieve its intended
+   *                 objective. For example, if xTaskGetId() was unable to
+   *                 locate the task by the task object (i.e., xTask) passed to
+   *                 the syscall, because either the object was null or invalid
+   *                 (e.g., a deleted task), xTaskGetId() would return
+   *                 ReturnError. All HeliOS syscalls return the xReturn
+   *                 (a.k.a., Return_t) type which can either be ReturnOK or
+   *                 ReturnError. The C macros OK() and ERROR() can be used as a
+   *                 more concise way of checking the return value of a syscall
+   *                 (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                 if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xStreamDelete(const xStreamBuffer stream_);
+
 
   /**
    * @brief Syscall to send a byte to a stream buffer
@@ -1807,12 +2369,82 @@
   xReturn xSystemGetSystemInfo(xSystemInfo *info_);
 
 
+  /**
+   * @brief Syscall to inquire about the time interrupts are disabled
+   *
+   * The xSystemGetCriticalSectionStats() syscall is used to obtain the number
+   * of times a critical section was entered, the longest time interrupts were
+   * disabled by it and a log2 histogram of the time interrupts were disabled
+   * by it. The statistics are only collected when
+   * CONFIG_CRITICAL_SECTION_STATS_ENABLE is defined, otherwise the syscall
+   * returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xCriticalSite
+   * @sa xCriticalSectionStats
+   * @sa CONFIG_CRITICAL_SECTION_STATS_ENABLE
+   * @sa xMemFree()
+   *
+   * @param  site_  The critical section to obtain statistics for.
+   * @param  stats_ The critical section statistics. The critical section
+   *                statistics must be freed by xMemFree().
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to
+   *                locate the task by the task object (i.e., xTask) passed to
+   *                the syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xSystemGetCriticalSectionStats(const xCriticalSite site_, xCriticalSectionStats *stats_);
+
+
+  /**
+   * @brief Syscall to get the storage size of a kernel object
+   *
+   * The xSystemGetStaticSize() syscall is used to obtain how many bytes of
+   * storage must be passed to xTaskCreateStatic(), xQueueCreateStatic(),
+   * xTimerCreateStatic() or xStreamCreateStatic(). The size depends on the
+   * target and on the configuration so it is best obtained once on the target
+   * and then used to size the storage in the application.
+   *
+   * @sa xReturn
+   * @sa xStaticObject
+   * @sa xSize
+   *
+   * @param  object_ The kind of kernel object to obtain the storage size for.
+   * @param  size_   The storage size, in bytes, for the kind of kernel object.
+   * @return         On success, the syscall returns ReturnOK. On failure, the
+   *                 syscall returns ReturnError. A failure is any condition in
+   *                 which the syscall was unable to achieve its intended
+   *                 objective. For example, if xTaskGetId() was unable to
+   *                 locate the task by the task object (i.e., xTask) passed to
+   *                 the syscall, because either the object was null or invalid
+   *                 (e.g., a deleted task), xTaskGetId() would return
+   *                 ReturnError. All HeliOS syscalls return the xReturn
+   *                 (a.k.a., Return_t) type which can either be ReturnOK or
+   *                 ReturnError. The C macros OK() and ERROR() can be used as a
+   *                 more concise way of checking the return value of a syscall
+   *                 (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                 if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xSystemGetStaticSize(const xStaticObject object_, xSize *size_);
+
+
   /**
    * @brief Syscall to create a new task
    *
-   * The xTaskCreate() syscall is used to create a new task. Neither the
-   * xTaskCreate() or xTaskDelete() syscalls can be called from within a task
-   * (i.e., while the scheduler is running).
+   * The xTaskCreate() syscall is used to create a new task. The xTaskCreate()
+   * syscall may be called from within a task (i.e., while the scheduler is
+   * running) to start workers on demand. Like every new task, a task created
+   * from within a task is in the suspended state until it is resumed or told
+   * to wait.
    *
    * @sa xReturn
    * @sa xTaskDelete()
@@ -1846,12 +2478,166 @@
   xReturn xTaskCreate(xTask *task_, const xByte *name_, void (*callback_)(xTask task_, xTaskParm parm_), xTaskParm taskParameter_);
 
 
+  /**
+   * @brief Syscall to create a new task with a priority level
+   *
+   * The xTaskCreateWithPriority() syscall is the same as xTaskCreate() except
+   * the new task is given a priority level instead of priority level zero. The
+   * scheduler always runs tasks in the highest priority level that has a task
+   * in the running state. Within a priority level, the scheduler runs the task
+   * with the least total runtime just as it does when every task is in the
+   * same priority level. Tasks that are waiting are not affected by their
+   * priority level. Like xTaskCreate(), xTaskCreateWithPriority() may be
+   * called from within a task (i.e., while the scheduler is running).
+   *
+   * @sa xReturn
+   * @sa xTaskCreate()
+   * @sa xTaskChangePriority()
+   * @sa xTaskGetPriority()
+   * @sa CONFIG_TASK_PRIORITY_LEVELS
+   *
+   * @param  task_          The task to be operated on.
+   * @param  name_          The name of the task which must be exactly
+   *                        CONFIG_TASK_NAME_BYTES (default is 8) bytes in
+   *                        length. Shorter task names must be padded.
+   * @param  callback_      The task's main (i.e., entry point) function.
+   * @param  taskParameter_ A parameter which is accessible from the task's main
+   *                        function. If a task parameter is not needed, this
+   *                        parameter may be set to null.
+   * @param  priority_      The priority level of the task which must be less
+   *                        than CONFIG_TASK_PRIORITY_LEVELS (default is 8).
+   *                        Zero is the lowest priority level.
+   * @return                On success, the syscall returns ReturnOK. On
+   *                        failure, the syscall returns ReturnError. A failure
+   *                        is any condition in which the syscall was unable to
+   *                        achieve its intended objective. For example, if
+   *                        xTaskGetId() was unable to locate the task by the
+   *                        task object (i.e., xTask) passed to the syscall,
+   *                        because either the object was null or invalid (e.g.,
+   *                        a deleted task), xTaskGetId() would return
+   *                        ReturnError. All HeliOS syscalls return the xReturn
+   *                        (a.k.a., Return_t) type which can either be ReturnOK
+   *                        or ReturnError. The C macros OK() and ERROR() can be
+   *                        used as a more concise way of checking the return
+   *                        value of a syscall (e.g., if(OK(xMemGetUsed(&size)))
+   *                        {} or if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskCreateWithPriority(xTask *task_, const xByte *name_, void (*callback_)(xTask task_, xTaskParm parm_), xTaskParm taskParameter_, const xBase
+    priority_);
+
+
+  /**
+   * @brief Syscall to create a new task with its own stack
+   *
+   * The xTaskCreateStackful() syscall is the same as xTaskCreate() except the
+   * new task runs on a stack of its own. Because of that, the task's main
+   * function may block in the middle of what it is doing by calling
+   * xTaskDelay() or xQueueReceiveBlocking() and carry on from there once what
+   * it is blocked on has happened. While a stackful task is blocked, the
+   * scheduler runs the other tasks as usual. If the task's main function
+   * returns, it is called again the next time the task is run just like a
+   * normal task. When a stackful task is deleted, its stack is freed along
+   * with whatever was on it. The stack is allocated from the kernel memory
+   * region. Stackful tasks are only supported on POSIX and
+   * CONFIG_TASK_STACKFUL_ENABLE must be defined to use them.
+   *
+   * @sa xReturn
+   * @sa xTaskCreate()
+   * @sa xTaskDelay()
+   * @sa xQueueReceiveBlocking()
+   * @sa CONFIG_TASK_STACKFUL_ENABLE
+   *
+   * @param  task_          The task to be operated on.
+   * @param  name_          The name of the task which must be exactly
+   *                        CONFIG_TASK_NAME_BYTES (default is 8) bytes in
+   *                        length. Shorter task names must be padded.
+   * @param  callback_      The task's main (i.e., entry point) function.
+   * @param  taskParameter_ A parameter which is accessible from the task's main
+   *                        function. If a task parameter is not needed, this
+   *                        parameter may be set to null.
+   * @param  bytes_         The size of the task's stack in bytes which must be
+   *                        at least 8192 bytes.
+   * @return                On success, the syscall returns ReturnOK. On
+   *                        failure, the syscall returns ReturnError. A failure
+   *                        is any condition in which the syscall was unable to
+   *                        achieve its intended objective. For example, if
+   *                        xTaskGetId() was unable to locate the task by the
+   *                        task object (i.e., xTask) passed to the syscall,
+   *                        because either the object was null or invalid (e.g.,
+   *                        a deleted task), xTaskGetId() would return
+   *                        ReturnError. All HeliOS syscalls return the xReturn
+   *                        (a.k.a., Return_t) type which can either be ReturnOK
+   *                        or ReturnError. The C macros OK() and ERROR() can be
+   *                        used as a more concise way of checking the return
+   *                        value of a syscall (e.g., if(OK(xMemGetUsed(&size)))
+   *                        {} or if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskCreateStackful(xTask *task_, const xByte *name_, void (*callback_)(xTask task_, xTaskParm parm_), xTaskParm taskParameter_, const xSize
+    bytes_);
+
+
+  /**
+   * @brief Syscall to create a new task in caller-owned storage
+   *
+   * The xTaskCreateStatic() syscall is the same as xTaskCreate() except the
+   * task is placed in storage owned by the caller instead of being allocated
+   * from the kernel memory region. The task list and the scheduler's task heaps
+   * are still allocated from the kernel memory region unless
+   * CONFIG_TASK_STATIC_HEAPS_ENABLE is defined. Once created, the task is used
+   * and deleted like any other. Deleting it does not free the storage,
+   * it only means the storage can be used again once xTaskDelete() returns or,
+   * if the scheduler is running, once the scheduler has finished with the
+   * task.
+   *
+   * @sa xReturn
+   * @sa xTask
+   * @sa xTaskCreate()
+   * @sa xTaskDelete()
+   * @sa xSystemGetStaticSize()
+   * @sa CONFIG_TASK_STATIC_HEAPS_ENABLE
+   *
+   * @param  task_          The task to be operated on.
+   * @param  storage_       Caller-owned storage for the task, which must stay
+   *                        valid until the task is deleted. It does not need to
+   *                        be aligned.
+   * @param  bytes_         The size of the storage in bytes. It must be at
+   *                        least the size returned by xSystemGetStaticSize()
+   *                        for StaticObjectTask.
+   * @param  name_          The name of the task which must be exactly
+   *                        CONFIG_TASK_NAME_BYTES (default is 8) bytes in
+   *                        length. Shorter task names must be padded.
+   * @param  callback_      The task's main (i.e., entry point) function.
+   * @param  taskParameter_ A parameter which is accessible from the task's main
+   *                        function. If a task parameter is not needed, this
+   *                        parameter may be set to null.
+   * @return                On success, the syscall returns ReturnOK. On
+   *                        failure, the syscall returns ReturnError. A failure
+   *                        is any condition in which the syscall was unable to
+   *                        achieve its intended objective. For example, if
+   *                        xTaskGetId() was unable to locate the task by the
+   *                        task object (i.e., xTask) passed to the syscall,
+   *                        because either the object was null or invalid (e.g.,
+   *                        a deleted task), xTaskGetId() would return
+   *                        ReturnError. All HeliOS syscalls return the xReturn
+   *                        (a.k.a., Return_t) type which can either be ReturnOK
+   *                        or ReturnError. The C macros OK() and ERROR() can be
+   *                        used as a more concise way of checking the return
+   *                        value of a syscall (e.g., if(OK(xMemGetUsed(&size)))
+   *                        {} or if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskCreateStatic(xTask *task_, xByte *storage_, const xSize bytes_, const xByte *name_, void (*callback_)(xTask task_, xTaskParm parm_), xTaskParm
+    taskParameter_);
+
+
   /**
    * @brief Syscall to delete a task.
    *
-   * The xTaskDelete() syscall is used to delete an existing task. Neither the
-   * xTaskCreate() or xTaskDelete() syscalls can be called from within a task
-   * (i.e., while the scheduler is running).
+   * The xTaskDelete() syscall is used to delete an existing task. The
+   * xTaskDelete() syscall may be called from within a task (i.e., while the
+   * scheduler is running), including by the task being deleted. The task
+   * handle is no longer valid once xTaskDelete() returns. However, because the
+   * scheduler may still be using the task, its memory is not freed until the
+   * scheduler has finished its current pass.
    *
    * @sa xReturn
    * @sa xTask
@@ -1878,11 +2664,13 @@
    * @brief Syscall to get the task handle by name
    *
    * The xTaskGetHandleByName() syscall will get the task handle using the task
-   * name.
+   * name. If CONFIG_TASK_INDEX_ENABLE is defined, tasks are indexed by a hash of
+   * their name so only the tasks that share a bucket with the name are compared.
    *
    * @sa xReturn
    * @sa xTask
    * @sa CONFIG_TASK_NAME_BYTES
+   * @sa CONFIG_TASK_INDEX_ENABLE
    *
    * @param  task_ The task to be operated on.
    * @param  name_ The name of the task which must be exactly
@@ -1913,6 +2701,7 @@
    *
    * @sa xReturn
    * @sa xTask
+   * @sa CONFIG_TASK_INDEX_ENABLE
    *
    * @param  task_ The task to be operated on.
    * @param  id_   The task id.
@@ -1995,6 +2784,109 @@
   xReturn xTaskGetTaskRunTimeStats(const xTask task_, xTaskRunTimeStats *stats_);
 
 
+  /**
+   * @brief Syscall to get a latency histogram for a task
+   *
+   * The xTaskGetLatencyHistogram() syscall is used to obtain either the runtime
+   * or the wake latency histogram of a task along with the number of times
+   * recorded, the longest time and the 99th percentile. Where
+   * xTaskGetTaskRunTimeStats() only has the last and total runtime, the
+   * histograms show how a task behaves in the worst cases. The histograms are
+   * only kept when CONFIG_TASK_HISTOGRAM_ENABLE is defined, otherwise the
+   * syscall returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTask
+   * @sa xTaskHistogramId
+   * @sa xTaskHistogram
+   * @sa CONFIG_TASK_HISTOGRAM_ENABLE
+   * @sa xMemFree()
+   *
+   * @param  task_      The task to be operated on.
+   * @param  id_        The histogram to obtain.
+   * @param  histogram_ The task latency histogram. The task latency histogram
+   *                    must be freed by xMemFree().
+   * @return            On success, the syscall returns ReturnOK. On failure,
+   *                    the syscall returns ReturnError. A failure is any
+   *                    condition in which the syscall was unable to achieve its
+   *                    intended objective. For example, if xTaskGetId() was
+   *                    unable to locate the task by the task object (i.e.,
+   *                    xTask) passed to the syscall, because either the object
+   *                    was null or invalid (e.g., a deleted task), xTaskGetId()
+   *                    would return ReturnError. All HeliOS syscalls return the
+   *                    xReturn (a.k.a., Return_t) type which can either be
+   *                    ReturnOK or ReturnError. The C macros OK() and ERROR()
+   *                    can be used as a more concise way of checking the return
+   *                    value of a syscall (e.g., if(OK(xMemGetUsed(&size))) {}
+   *                    or if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetLatencyHistogram(const xTask task_, const xTaskHistogramId id_, xTaskHistogram *histogram_);
+
+
+  /**
+   * @brief Syscall to get the scheduler event trace
+   *
+   * The xTaskGetTrace() syscall is used to obtain the events recorded by the
+   * scheduler event trace, oldest first. The trace shows what the scheduler did
+   * leading up to a problem such as a deadline miss and can be turned into a
+   * timeline with the tracejson host tool in test/tools. Obtaining the trace
+   * does not clear it, see xTaskClearTrace(). The trace is only kept when
+   * CONFIG_TRACE_ENABLE is defined, otherwise the syscall returns ReturnError.
+   * The syscall also returns ReturnError if no events have been recorded.
+   *
+   * @sa xReturn
+   * @sa xTraceEvent
+   * @sa xTaskClearTrace()
+   * @sa CONFIG_TRACE_ENABLE
+   * @sa CONFIG_TRACE_BUFFER_EVENTS
+   * @sa xMemFree()
+   *
+   * @param  events_ The trace events. The trace events must be freed by
+   *                 xMemFree().
+   * @param  count_  The number of trace events.
+   * @return         On success, the syscall returns ReturnOK. On failure, the
+   *                 syscall returns ReturnError. A failure is any condition in
+   *                 which the syscall was unable to achieve its intended
+   *                 objective. For example, if xTaskGetId() was unable to
+   *                 locate the task by the task object (i.e., xTask) passed to
+   *                 the syscall, because either the object was null or invalid
+   *                 (e.g., a deleted task), xTaskGetId() would return
+   *                 ReturnError. All HeliOS syscalls return the xReturn
+   *                 (a.k.a., Return_t) type which can either be ReturnOK or
+   *                 ReturnError. The C macros OK() and ERROR() can be used as a
+   *                 more concise way of checking the return value of a syscall
+   *                 (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                 if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetTrace(xTraceEvent *events_, xHalfWord *count_);
+
+
+  /**
+   * @brief Syscall to clear the scheduler event trace
+   *
+   * The xTaskClearTrace() syscall is used to discard every event recorded by
+   * the scheduler event trace so far. The trace is only kept when
+   * CONFIG_TRACE_ENABLE is defined, otherwise the syscall returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskGetTrace()
+   * @sa CONFIG_TRACE_ENABLE
+   *
+   * @return On success, the syscall returns ReturnOK. On failure, the syscall
+   *         returns ReturnError. A failure is any condition in which the
+   *         syscall was unable to achieve its intended objective. For example,
+   *         if xTaskGetId() was unable to locate the task by the task object
+   *         (i.e., xTask) passed to the syscall, because either the object was
+   *         null or invalid (e.g., a deleted task), xTaskGetId() would return
+   *         ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *         Return_t) type which can either be ReturnOK or ReturnError. The C
+   *         macros OK() and ERROR() can be used as a more concise way of
+   *         checking the return value of a syscall (e.g.,
+   *         if(OK(xMemGetUsed(&size))) {} or if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskClearTrace(void);
+
+
   /**
    * @brief Syscall to get the number of tasks
    *
@@ -2178,7 +3070,8 @@
    * @brief Syscall to clear a waiting direct-to-task notification
    *
    * The xTaskNotifyStateClear() syscall is used to clear a waiting
-   * direct-to-task notification for the given task.
+   * direct-to-task notification for the given task, including any counting or
+   * bitwise direct-to-task notification.
    *
    * @sa xReturn
    * @sa xTask
@@ -2206,7 +3099,8 @@
    * waiting
    *
    * The xTaskNotificationIsWaiting() syscall is used to inquire as to whether a
-   * direct-to-task notification is waiting for the given task.
+   * direct-to-task notification is waiting for the given task. A counting or
+   * bitwise direct-to-task notification counts as a waiting notification.
    *
    * @sa xReturn
    * @sa xTask
@@ -2297,17 +3191,27 @@
 
 
   /**
-   * @brief Syscall to place a task in the "running" state
+   * @brief Syscall to give (i.e., send) a task a counting direct-to-task
+   * notification
    *
-   * The xTaskResume() syscall will place a task in the "running" state. A task
-   * in this state will run continuously until suspended and is scheduled to run
-   * cooperatively by the HeliOS scheduler.
+   * The xTaskNotifyGiveCount() syscall is used to give (i.e., send) a counting
+   * direct-to-task notification to the given task. Each give adds one to the
+   * task's notification count, so unlike xTaskNotifyGive() a give does not fail
+   * because a notification is already waiting and a burst of events is never
+   * lost. A waiting task is run by the scheduler on its next pass. The syscall
+   * must not be called from an interrupt service routine, use
+   * xTaskNotifyGiveCountFromISR() instead.
+   *
+   * The count saturates rather than wraps so, if it cannot be added to, the
+   * syscall returns ReturnError.
+   *
+   * The syscall is only available if CONFIG_TASK_NOTIFY_EVENTS_ENABLE is
+   * defined. Otherwise it always returns ReturnError.
    *
    * @sa xReturn
+   * @sa CONFIG_TASK_NOTIFY_EVENTS_ENABLE
    * @sa xTask
-   * @sa xTaskResume()
-   * @sa xTaskSuspend()
-   * @sa xTaskWait()
+   * @sa xTaskNotifyTakeCount()
    *
    * @param  task_ The task to be operated on.
    * @return       On success, the syscall returns ReturnOK. On failure, the
@@ -2324,30 +3228,259 @@
    *               if(OK(xMemGetUsed(&size))) {} or
    *               if(ERROR(xMemGetUsed(&size))) {}).
    */
-  xReturn xTaskResume(xTask task_);
+  xReturn xTaskNotifyGiveCount(xTask task_);
 
 
   /**
-   * @brief Syscall to place a task in the "suspended" state
+   * @brief Syscall to take (i.e., receive) a task's counting direct-to-task
+   * notification
    *
-   * The xTaskSuspend() syscall will place a task in the "suspended" state. A
-   * task in this state is not scheduled to run by the HeliOS scheduler and will
-   * not run.
+   * The xTaskNotifyTakeCount() syscall is used to take (i.e., receive) every
+   * counting direct-to-task notification given to the task since it was last
+   * taken and reset the count to zero. If none were given, the count is zero
+   * and the syscall still succeeds. A waiting task with a count keeps being run
+   * by the scheduler until it is taken.
+   *
+   * The syscall is only available if CONFIG_TASK_NOTIFY_EVENTS_ENABLE is
+   * defined. Otherwise it always returns ReturnError.
    *
    * @sa xReturn
+   * @sa CONFIG_TASK_NOTIFY_EVENTS_ENABLE
    * @sa xTask
-   * @sa xTaskResume()
-   * @sa xTaskSuspend()
-   * @sa xTaskWait()
+   * @sa xWord
+   * @sa xTaskNotifyGiveCount()
    *
-   * @param  task_ The task to be operated on.
-   * @return       On success, the syscall returns ReturnOK. On failure, the
-   *               syscall returns ReturnError. A failure is any condition in
-   *               which the syscall was unable to achieve its intended
-   *               objective. For example, if xTaskGetId() was unable to locate
-   *               the task by the task object (i.e., xTask) passed to the
-   *               syscall, because either the object was null or invalid (e.g.,
-   *               a deleted task), xTaskGetId() would return ReturnError. All
+   * @param  task_  The task to be operated on.
+   * @param  count_ The number of counting direct-to-task notifications given to
+   *                the task since they were last taken.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskNotifyTakeCount(xTask task_, xWord *count_);
+
+
+  /**
+   * @brief Syscall to give (i.e., send) a task a bitwise direct-to-task
+   * notification
+   *
+   * The xTaskNotifyGiveBits() syscall is used to give (i.e., send) a bitwise
+   * direct-to-task notification to the given task. The bits are OR'd into the
+   * task's notification bits so events given while others are still waiting are
+   * combined rather than lost. The syscall must not be called from an
+   * interrupt service routine, use xTaskNotifyGiveBitsFromISR() instead.
+   *
+   * The syscall is only available if CONFIG_TASK_NOTIFY_EVENTS_ENABLE is
+   * defined. Otherwise it always returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa CONFIG_TASK_NOTIFY_EVENTS_ENABLE
+   * @sa xTask
+   * @sa xWord
+   * @sa xTaskNotifyTakeBits()
+   *
+   * @param  task_ The task to be operated on.
+   * @param  bits_ The bits to set in the task's notification bits. At least one
+   *               bit must be set.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskNotifyGiveBits(xTask task_, const xWord bits_);
+
+
+  /**
+   * @brief Syscall to take (i.e., receive) a task's bitwise direct-to-task
+   * notification
+   *
+   * The xTaskNotifyTakeBits() syscall is used to take (i.e., receive) the bits
+   * given to the task by xTaskNotifyGiveBits() since they were last taken and
+   * clear them. If none were given, the bits are zero and the syscall still
+   * succeeds.
+   *
+   * The syscall is only available if CONFIG_TASK_NOTIFY_EVENTS_ENABLE is
+   * defined. Otherwise it always returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa CONFIG_TASK_NOTIFY_EVENTS_ENABLE
+   * @sa xTask
+   * @sa xWord
+   * @sa xTaskNotifyGiveBits()
+   *
+   * @param  task_ The task to be operated on.
+   * @param  bits_ The bits given to the task since they were last taken.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskNotifyTakeBits(xTask task_, xWord *bits_);
+
+
+  /**
+   * @brief Syscall to give (i.e., send) a task a counting direct-to-task
+   * notification from an interrupt service routine
+   *
+   * The xTaskNotifyGiveCountFromISR() syscall is the interrupt service routine
+   * variant of xTaskNotifyGiveCount(). It only disables interrupts long enough
+   * to add one to the task's notification count and mark the task for the
+   * scheduler, which runs the task on its next pass. It does not take the
+   * kernel lock and does not look up the task, so the task passed to the
+   * syscall must be valid and must not be deleted while an interrupt may give
+   * it a notification. On POSIX, where interrupts are not disabled, the syscall
+   * must not be called from a thread other than the one running the scheduler.
+   *
+   * The syscall is only available if CONFIG_TASK_NOTIFY_EVENTS_ENABLE is
+   * defined. Otherwise it always returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa CONFIG_TASK_NOTIFY_EVENTS_ENABLE
+   * @sa xTask
+   * @sa xTaskNotifyGiveCount()
+   * @sa xTaskNotifyTakeCount()
+   *
+   * @param  task_ The task to be operated on.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskNotifyGiveCountFromISR(xTask task_);
+
+
+  /**
+   * @brief Syscall to give (i.e., send) a task a bitwise direct-to-task
+   * notification from an interrupt service routine
+   *
+   * The xTaskNotifyGiveBitsFromISR() syscall is the interrupt service routine
+   * variant of xTaskNotifyGiveBits(). It only disables interrupts long enough
+   * to OR the bits into the task's notification bits and mark the task for the
+   * scheduler, which runs the task on its next pass. It does not take the
+   * kernel lock and does not look up the task, so the task passed to the
+   * syscall must be valid and must not be deleted while an interrupt may give
+   * it a notification. On POSIX, where interrupts are not disabled, the syscall
+   * must not be called from a thread other than the one running the scheduler.
+   *
+   * The syscall is only available if CONFIG_TASK_NOTIFY_EVENTS_ENABLE is
+   * defined. Otherwise it always returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa CONFIG_TASK_NOTIFY_EVENTS_ENABLE
+   * @sa xTask
+   * @sa xWord
+   * @sa xTaskNotifyGiveBits()
+   * @sa xTaskNotifyTakeBits()
+   *
+   * @param  task_ The task to be operated on.
+   * @param  bits_ The bits to set in the task's notification bits. At least one
+   *               bit must be set.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskNotifyGiveBitsFromISR(xTask task_, const xWord bits_);
+
+
+  /**
+   * @brief Syscall to place a task in the "running" state
+   *
+   * The xTaskResume() syscall will place a task in the "running" state. A task
+   * in this state will run continuously until suspended and is scheduled to run
+   * cooperatively by the HeliOS scheduler.
+   *
+   * @sa xReturn
+   * @sa xTask
+   * @sa xTaskResume()
+   * @sa xTaskSuspend()
+   * @sa xTaskWait()
+   *
+   * @param  task_ The task to be operated on.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskResume(xTask task_);
+
+
+  /**
+   * @brief Syscall to place a task in the "suspended" state
+   *
+   * The xTaskSuspend() syscall will place a task in the "suspended" state. A
+   * task in this state is not scheduled to run by the HeliOS scheduler and will
+   * not run.
+   *
+   * @sa xReturn
+   * @sa xTask
+   * @sa xTaskResume()
+   * @sa xTaskSuspend()
+   * @sa xTaskWait()
+   *
+   * @param  task_ The task to be operated on.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
    *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
    *               which can either be ReturnOK or ReturnError. The C macros
    *               OK() and ERROR() can be used as a more concise way of
@@ -2400,12 +3533,15 @@
    * timer. The period is measured in ticks. While architecture and/or platform
    * dependent, a tick is often one millisecond. In order for the task timer to
    * have an effect, the task must be in the "waiting" state which can be set
-   * using xTaskWait().
+   * using xTaskWait(). If the task timer had no period, it is started when the
+   * period is set so the task timer first elapses a whole period later. To
+   * start the task timer over at any other time, use xTaskResetTimer().
    *
    * @sa xReturn
    * @sa xTask
    * @sa xTicks
    * @sa xTaskWait()
+   * @sa xTaskResetTimer()
    *
    * @param  task_   The task to be operated on.
    * @param  period_ The interval period in ticks.
@@ -2496,16 +3632,153 @@
 
 
   /**
-   * @brief Syscall to set the task timer elapsed time to zero
+   * @brief Syscall to change the release policy of a task
    *
-   * The xTaskResetTimer() syscall is used to reset the task timer. In effect,
-   * this sets the elapsed time, measured in ticks, back to zero.
+   * The xTaskChangeReleasePolicy() syscall is used to change how the task timer
+   * of a task is restarted after the scheduler runs the task because its task
+   * timer elapsed. With TaskReleasePolicyRelative, the default, the next period
+   * starts when the task is run. With TaskReleasePolicyCatchUp or
+   * TaskReleasePolicySkip, the next period starts where the last one ended so a
+   * periodic task does not drift. The two differ only in what happens when the
+   * task falls more than a period behind. The release jitter and overrun
+   * statistics for the task are reported by xTaskGetTaskRunTimeStats().
    *
    * @sa xReturn
-   * @sa xTask
-   * @sa xTicks
+   * @sa xTaskReleasePolicy
+   * @sa xTaskGetReleasePolicy()
+   * @sa xTaskChangePeriod()
+   * @sa xTaskResetTimer()
+   *
+   * @param  task_   The task to be operated on.
+   * @param  policy_ The release policy.
+   * @return         On success, the syscall returns ReturnOK. On failure, the
+   *                 syscall returns ReturnError. A failure is any condition in
+   *                 which the syscall was unable to achieve its intended
+   *                 objective. For example, if xTaskGetId() was unable to
+   *                 locate the task by the task object (i.e., xTask) passed to
+   *                 the syscall, because either the object was null or invalid
+   *                 (e.g., a deleted task), xTaskGetId() would return
+   *                 ReturnError. All HeliOS syscalls return the xReturn
+   *                 (a.k.a., Return_t) type which can either be ReturnOK or
+   *                 ReturnError. The C macros OK() and ERROR() can be used as a
+   *                 more concise way of checking the return value of a syscall
+   *                 (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                 if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskChangeReleasePolicy(xTask task_, const xTaskReleasePolicy policy_);
+
+
+  /**
+   * @brief Syscall to obtain the release policy of a task
+   *
+   * The xTaskGetReleasePolicy() syscall is used to obtain the release policy of
+   * a task.
+   *
+   * @sa xReturn
+   * @sa xTaskReleasePolicy
+   * @sa xTaskChangeReleasePolicy()
+   *
+   * @param  task_   The task to be operated on.
+   * @param  policy_ The release policy of the task.
+   * @return         On success, the syscall returns ReturnOK. On failure, the
+   *                 syscall returns ReturnError. A failure is any condition in
+   *                 which the syscall was unable to achieve its intended
+   *                 objective. For example, if xTaskGetId() was unable to
+   *                 locate the task by the task object (i.e., xTask) passed to
+   *                 the syscall, because either the object was null or invalid
+   *                 (e.g., a deleted task), xTaskGetId() would return
+   *                 ReturnError. All HeliOS syscalls return the xReturn
+   *                 (a.k.a., Return_t) type which can either be ReturnOK or
+   *                 ReturnError. The C macros OK() and ERROR() can be used as a
+   *                 more concise way of checking the return value of a syscall
+   *                 (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                 if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetReleasePolicy(const xTask task_, xTaskReleasePolicy *policy_);
+
+
+  /**
+   * @brief Syscall to change the priority level of a task
+   *
+   * The xTaskChangePriority() syscall is used to change the priority level of
+   * a task. Unlike xTaskCreateWithPriority(), xTaskChangePriority() may be
+   * called from within a task. If the task is in the running state, it is
+   * moved to its new priority level right away and keeps its total runtime.
+   *
+   * @sa xReturn
+   * @sa xTaskCreateWithPriority()
+   * @sa xTaskGetPriority()
+   * @sa CONFIG_TASK_PRIORITY_LEVELS
+   *
+   * @param  task_     The task to be operated on.
+   * @param  priority_ The new priority level of the task which must be less
+   *                   than CONFIG_TASK_PRIORITY_LEVELS (default is 8).
+   * @return           On success, the syscall returns ReturnOK. On failure, the
+   *                   syscall returns ReturnError. A failure is any condition
+   *                   in which the syscall was unable to achieve its intended
+   *                   objective. For example, if xTaskGetId() was unable to
+   *                   locate the task by the task object (i.e., xTask) passed
+   *                   to the syscall, because either the object was null or
+   *                   invalid (e.g., a deleted task), xTaskGetId() would return
+   *                   ReturnError. All HeliOS syscalls return the xReturn
+   *                   (a.k.a., Return_t) type which can either be ReturnOK or
+   *                   ReturnError. The C macros OK() and ERROR() can be used as
+   *                   a more concise way of checking the return value of a
+   *                   syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                   if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskChangePriority(xTask task_, const xBase priority_);
+
+
+  /**
+   * @brief Syscall to obtain the priority level of a task
+   *
+   * The xTaskGetPriority() syscall is used to obtain the priority level of a
+   * task. Tasks created with xTaskCreate() are in priority level zero.
+   *
+   * @sa xReturn
+   * @sa xTaskCreateWithPriority()
+   * @sa xTaskChangePriority()
+   *
+   * @param  task_     The task to be operated on.
+   * @param  priority_ The priority level of the task.
+   * @return           On success, the syscall returns ReturnOK. On failure, the
+   *                   syscall returns ReturnError. A failure is any condition
+   *                   in which the syscall was unable to achieve its intended
+   *                   objective. For example, if xTaskGetId() was unable to
+   *                   locate the task by the task object (i.e., xTask) passed
+   *                   to the syscall, because either the object was null or
+   *                   invalid (e.g., a deleted task), xTaskGetId() would return
+   *                   ReturnError. All HeliOS syscalls return the xReturn
+   *                   (a.k.a., Return_t) type which can either be ReturnOK or
+   *                   ReturnError. The C macros OK() and ERROR() can be used as
+   *                   a more concise way of checking the return value of a
+   *                   syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                   if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetPriority(const xTask task_, xBase *priority_);
+
+
+  /**
+   * @brief Syscall to pin a task to a scheduler instance
+   *
+   * The xTaskSetAffinity() syscall is used to pin a task to one of the
+   * CONFIG_SCHEDULER_CORES scheduler instances. Each instance has its own
+   * ready heaps, timer heap and task state lists and only runs the tasks pinned
+   * to it, so a task's latency depends only on the other tasks on the same
+   * instance. A task starts out on the instance it was created from, which is
+   * instance zero unless it was created by a task running on another instance.
+   * Tasks may only be pinned while the scheduler is not running and stackful
+   * tasks always stay on instance zero.
+   *
+   * @sa xReturn
+   * @sa xTaskGetAffinity()
+   * @sa xTaskStartSchedulerCores()
+   * @sa CONFIG_SCHEDULER_CORES
    *
    * @param  task_ The task to be operated on.
+   * @param  core_ The scheduler instance to pin the task to, from zero up to
+   *               one less than CONFIG_SCHEDULER_CORES.
    * @return       On success, the syscall returns ReturnOK. On failure, the
    *               syscall returns ReturnError. A failure is any condition in
    *               which the syscall was unable to achieve its intended
@@ -2520,41 +3793,191 @@
    *               if(OK(xMemGetUsed(&size))) {} or
    *               if(ERROR(xMemGetUsed(&size))) {}).
    */
-  xReturn xTaskResetTimer(xTask task_);
+  xReturn xTaskSetAffinity(xTask task_, const xBase core_);
 
 
   /**
-   * @brief Syscall to start the HeliOS scheduler
+   * @brief Syscall to obtain the scheduler instance a task is pinned to
    *
-   * The xTaskStartScheduler() syscall is used to start the HeliOS task
-   * scheduler. On this syscall is made, control is handed over to HeliOS. In
-   * order to suspend the scheduler and return to the caller, the
-   * xTaskSuspendAll() syscall will need to be made. Once a call to
-   * xTaskSuspendAll() is made, xTaskResumeAll() must be called before calling
-   * xTaskStartScheduler() again. If xTaskStartScheduler() is called while the
-   * scheduler is in a suspended state, xTaskStartScheduler() will immediately
-   * return.
+   * The xTaskGetAffinity() syscall is used to obtain the scheduler instance a
+   * task is pinned to.
    *
    * @sa xReturn
-   * @sa xTaskResumeAll()
-   * @sa xTaskSuspendAll()
-   *
+   * @sa xTaskSetAffinity()
    *
-   * @return On success, the syscall returns ReturnOK. On failure, the syscall
-   *         returns ReturnError. A failure is any condition in which the
-   *         syscall was unable to achieve its intended objective. For example,
-   *         if xTaskGetId() was unable to locate the task by the task object
-   *         (i.e., xTask) passed to the syscall, because either the object was
-   *         null or invalid (e.g., a deleted task), xTaskGetId() would return
-   *         ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
-   *         Return_t) type which can either be ReturnOK or ReturnError. The C
-   *         macros OK() and ERROR() can be used as a more concise way of
-   *         checking the return value of a syscall (e.g.,
-   *         if(OK(xMemGetUsed(&size))) {} or if(ERROR(xMemGetUsed(&size))) {}).
-   */
+   * @param  task_ The task to be operated on.
+   * @param  core_ The scheduler instance the task is pinned to.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetAffinity(const xTask task_, xBase *core_);
+
+
+  /**
+   * @brief Syscall to set the task timer elapsed time to zero
+   *
+   * The xTaskResetTimer() syscall is used to reset the task timer. In effect,
+   * this sets the elapsed time, measured in ticks, back to zero.
+   *
+   * @sa xReturn
+   * @sa xTask
+   * @sa xTicks
+   *
+   * @param  task_ The task to be operated on.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskResetTimer(xTask task_);
+
+
+  /**
+   * @brief Syscall to start the HeliOS scheduler
+   *
+   * The xTaskStartScheduler() syscall is used to start the HeliOS task
+   * scheduler. On this syscall is made, control is handed over to HeliOS. In
+   * order to suspend the scheduler and return to the caller, the
+   * xTaskSuspendAll() syscall will need to be made. Once a call to
+   * xTaskSuspendAll() is made, xTaskResumeAll() must be called before calling
+   * xTaskStartScheduler() again. If xTaskStartScheduler() is called while the
+   * scheduler is in a suspended state, xTaskStartScheduler() will immediately
+   * return.
+   *
+   * @sa xReturn
+   * @sa xTaskResumeAll()
+   * @sa xTaskSuspendAll()
+   *
+   *
+   * @return On success, the syscall returns ReturnOK. On failure, the syscall
+   *         returns ReturnError. A failure is any condition in which the
+   *         syscall was unable to achieve its intended objective. For example,
+   *         if xTaskGetId() was unable to locate the task by the task object
+   *         (i.e., xTask) passed to the syscall, because either the object was
+   *         null or invalid (e.g., a deleted task), xTaskGetId() would return
+   *         ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *         Return_t) type which can either be ReturnOK or ReturnError. The C
+   *         macros OK() and ERROR() can be used as a more concise way of
+   *         checking the return value of a syscall (e.g.,
+   *         if(OK(xMemGetUsed(&size))) {} or if(ERROR(xMemGetUsed(&size))) {}).
+   */
   xReturn xTaskStartScheduler(void);
 
 
+  /**
+   * @brief Syscall to start the HeliOS scheduler on more than one thread
+   *
+   * The xTaskStartSchedulerThreads() syscall is used to start the HeliOS task
+   * scheduler in the same way as xTaskStartScheduler() except that ready tasks
+   * are run on up to the number of threads requested. On each pass the
+   * scheduler hands the ready tasks of the highest priority level to a pool of
+   * worker threads, each with its own run queue, and an idle worker steals
+   * tasks from the run queues of busy workers. A task is never run on two
+   * threads at the same time and syscalls are serialized by a kernel lock, so
+   * task callbacks may make syscalls as usual, but task callbacks that share
+   * application data with other tasks must protect it themselves. Stackful
+   * tasks are always run on the thread that called
+   * xTaskStartSchedulerThreads(). Once the scheduler is suspended with
+   * xTaskSuspendAll(), the worker threads are stopped before
+   * xTaskStartSchedulerThreads() returns. The
+   * xTaskStartSchedulerThreads() syscall is only available on POSIX when
+   * CONFIG_SCHEDULER_THREADS_ENABLE is defined.
+   *
+   * @sa xReturn
+   * @sa xTaskStartScheduler()
+   * @sa xTaskSuspendAll()
+   * @sa CONFIG_SCHEDULER_THREADS_ENABLE
+   * @sa CONFIG_SCHEDULER_THREADS_MAXIMUM
+   *
+   * @param  threads_ The number of threads to run tasks on, from one up to
+   *                  CONFIG_SCHEDULER_THREADS_MAXIMUM. A value of one behaves
+   *                  the same as xTaskStartScheduler().
+   * @return          On success, the syscall returns ReturnOK. On failure, the
+   *                  syscall returns ReturnError. A failure is any condition in
+   *                  which the syscall was unable to achieve its intended
+   *                  objective. For example, if xTaskGetId() was unable to
+   *                  locate the task by the task object (i.e., xTask) passed to
+   *                  the syscall, because either the object was null or invalid
+   *                  (e.g., a deleted task), xTaskGetId() would return
+   *                  ReturnError. All HeliOS syscalls return the xReturn
+   *                  (a.k.a., Return_t) type which can either be ReturnOK or
+   *                  ReturnError. The C macros OK() and ERROR() can be used as
+   *                  a more concise way of checking the return value of a
+   *                  syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                  if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskStartSchedulerThreads(const xBase threads_);
+
+
+  /**
+   * @brief Syscall to start every scheduler instance on its own thread
+   *
+   * The xTaskStartSchedulerCores() syscall is used to start the first number
+   * of scheduler instances, each on its own POSIX thread. The caller runs
+   * instance zero. Unlike xTaskStartSchedulerThreads(), tasks are not shared
+   * between the threads. Each instance only runs the tasks pinned to it with
+   * xTaskSetAffinity() and sleeps when none of them has anything to do. When a
+   * syscall made on one instance gives a task on another instance something to
+   * do, such as a direct to task notification, the other instance is woken
+   * without waiting on it. xTaskSuspendAll() and xTaskResumeAll() act on the
+   * instance they are called from, so the instances are typically suspended
+   * from the idle hook or a task on each of them, and
+   * xTaskStartSchedulerCores() returns once every instance has been suspended.
+   * The instances other than zero start out in the state of instance zero.
+   * Syscalls are serialized by the kernel lock so task callbacks may make
+   * syscalls as usual, but task callbacks on different instances that share
+   * application data must protect it themselves. Every instance takes the
+   * same kernel lock for its scheduler pass and the task list is shared, so
+   * only the task callbacks run in parallel, not the instances' schedulers.
+   * The idle time is kept for each instance. The xTaskStartSchedulerCores()
+   * syscall is only available on POSIX.
+   *
+   * @sa xReturn
+   * @sa xTaskSetAffinity()
+   * @sa xTaskStartScheduler()
+   * @sa xTaskSuspendAll()
+   * @sa CONFIG_SCHEDULER_CORES
+   *
+   * @param  cores_ The number of scheduler instances to start, from one up to
+   *                CONFIG_SCHEDULER_CORES. Tasks pinned to the instances that
+   *                are not started are not run.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskStartSchedulerCores(const xBase cores_);
+
+
   /**
    * @brief Syscall to set the scheduler state to running
    *
@@ -2590,7 +4013,8 @@
    * suspended. If called from a running task, the HeliOS scheduler will quit
    * and return control back to the caller. To set the scheduler state to
    * running, xTaskResumeAll() must be called followed by a call to
-   * xTaskStartScheduler().
+   * xTaskStartScheduler(). With more than one scheduler instance, only the
+   * instance xTaskSuspendAll() is called from is suspended.
    *
    * @sa xReturn
    * @sa xTaskStartScheduler()
@@ -2671,6 +4095,468 @@
   xReturn xTaskGetWDPeriod(const xTask task_, xTicks *period_);
 
 
+  /**
+   * @brief Syscall to set the idle hook
+   *
+   * The xTaskSetIdleHook() syscall is used to set a function the scheduler will
+   * call whenever it is idle. The scheduler is idle when no task is in the
+   * running state and no waiting task has a notification. The idle hook is
+   * called before the scheduler sleeps (see CONFIG_TICKLESS_IDLE_ENABLE) and
+   * must not block. The idle hook may call xTaskSuspendAll() or
+   * xTaskNotifyGive(), in which case the scheduler will not sleep. Passing null
+   * removes the idle hook.
+   *
+   * @sa xReturn
+   * @sa xTaskGetIdleTime()
+   * @sa CONFIG_TICKLESS_IDLE_ENABLE
+   *
+   * @param  hook_ The function to call when the scheduler is idle or null.
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid
+   *               (e.g., a deleted task), xTaskGetId() would return
+   *               ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *               Return_t) type which can either be ReturnOK or ReturnError.
+   *               The C macros OK() and ERROR() can be used as a more concise
+   *               way of checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskSetIdleHook(void (*hook_)(void));
+
+
+  /**
+   * @brief Syscall to get the time the scheduler has been idle
+   *
+   * The xTaskGetIdleTime() syscall is used to obtain the total time, measured
+   * in ticks, the scheduler has been idle. This includes time spent in the idle
+   * hook and, if CONFIG_TICKLESS_IDLE_ENABLE is defined, time spent sleeping.
+   * Comparing the idle time against the system ticks gives the processor
+   * utilization. The idle time is kept for each scheduler instance started by
+   * xTaskStartSchedulerCores() and the syscall obtains the idle time of the
+   * instance it is called from, which is instance zero outside of the
+   * scheduler. To obtain the idle time of any other instance, use
+   * xTaskGetCoreIdleTime().
+   *
+   * @sa xReturn
+   * @sa xTicks
+   * @sa xTaskSetIdleHook()
+   * @sa xTaskGetCoreIdleTime()
+   * @sa CONFIG_TICKLESS_IDLE_ENABLE
+   *
+   * @param  ticks_ The total idle time, measured in ticks. Ticks are platform
+   *                and/or architecture dependent. However, on must platforms
+   *                and/or architectures the tick represents one millisecond.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetIdleTime(xTicks *ticks_);
+
+
+  /**
+   * @brief Syscall to get the time a scheduler instance has been idle
+   *
+   * The xTaskGetCoreIdleTime() syscall is used to obtain the total time,
+   * measured in ticks, the given scheduler instance has been idle. It is the
+   * same as xTaskGetIdleTime() except that the instance is given rather than
+   * being the one the syscall is called from.
+   *
+   * @sa xReturn
+   * @sa xBase
+   * @sa xTicks
+   * @sa xTaskGetIdleTime()
+   * @sa xTaskStartSchedulerCores()
+   * @sa CONFIG_SCHEDULER_CORES
+   *
+   * @param  core_  The scheduler instance, from zero up to one less than
+   *                CONFIG_SCHEDULER_CORES.
+   * @param  ticks_ The total idle time, measured in ticks. Ticks are platform
+   *                and/or architecture dependent. However, on must platforms
+   *                and/or architectures the tick represents one millisecond.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetCoreIdleTime(const xBase core_, xTicks *ticks_);
+
+
+  /**
+   * @brief Syscall to get the CPU utilization of a task
+   *
+   * The xTaskGetUtilization() syscall is used to obtain the share of the CPU a
+   * task used over the utilization window, in tenths of a percent (i.e., 1000
+   * is 100%). Unlike the total runtime of a task, which is cumulative and is
+   * reset when it overflows, the utilization only covers the last
+   * CONFIG_TASK_UTILIZATION_SLOTS slots of CONFIG_TASK_UTILIZATION_SLOT_TICKS
+   * ticks so it shows what the task is doing now. The utilization is only kept
+   * when CONFIG_TASK_UTILIZATION_ENABLE is defined, otherwise the syscall
+   * returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTask
+   * @sa xTaskGetIdleUtilization()
+   * @sa CONFIG_TASK_UTILIZATION_ENABLE
+   *
+   * @param  task_        The task to be operated on.
+   * @param  utilization_ The share of the CPU, in tenths of a percent, the task
+   *                      used over the utilization window.
+   * @return              On success, the syscall returns ReturnOK. On failure,
+   *                      the syscall returns ReturnError. A failure is any
+   *                      condition in which the syscall was unable to achieve
+   *                      its intended objective. For example, if xTaskGetId()
+   *                      was unable to locate the task by the task object
+   *                      (i.e., xTask) passed to the syscall, because either
+   *                      the object was null or invalid (e.g., a deleted task),
+   *                      xTaskGetId() would return ReturnError. All HeliOS
+   *                      syscalls return the xReturn (a.k.a., Return_t) type
+   *                      which can either be ReturnOK or ReturnError. The C
+   *                      macros OK() and ERROR() can be used as a more concise
+   *                      way of checking the return value of a syscall (e.g.,
+   *                      if(OK(xMemGetUsed(&size))) {} or
+   *                      if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetUtilization(const xTask task_, xHalfWord *utilization_);
+
+
+  /**
+   * @brief Syscall to get the share of the CPU the scheduler was idle
+   *
+   * The xTaskGetIdleUtilization() syscall is used to obtain the share of the
+   * CPU, in tenths of a percent (i.e., 1000 is 100%), the scheduler instance
+   * the syscall is called from was idle over the utilization window. This is
+   * the headroom left for more work. Time
+   * the scheduler spends deciding what to run is neither idle time nor counted
+   * against any task so the idle utilization and the utilization of every task
+   * add up to a little less than 1000. The utilization is only kept when
+   * CONFIG_TASK_UTILIZATION_ENABLE is defined, otherwise the syscall returns
+   * ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskGetUtilization()
+   * @sa xTaskGetIdleTime()
+   * @sa CONFIG_TASK_UTILIZATION_ENABLE
+   *
+   * @param  utilization_ The share of the CPU, in tenths of a percent, the
+   *                      scheduler was idle over the utilization window.
+   * @return              On success, the syscall returns ReturnOK. On failure,
+   *                      the syscall returns ReturnError. A failure is any
+   *                      condition in which the syscall was unable to achieve
+   *                      its intended objective. For example, if xTaskGetId()
+   *                      was unable to locate the task by the task object
+   *                      (i.e., xTask) passed to the syscall, because either
+   *                      the object was null or invalid (e.g., a deleted task),
+   *                      xTaskGetId() would return ReturnError. All HeliOS
+   *                      syscalls return the xReturn (a.k.a., Return_t) type
+   *                      which can either be ReturnOK or ReturnError. The C
+   *                      macros OK() and ERROR() can be used as a more concise
+   *                      way of checking the return value of a syscall (e.g.,
+   *                      if(OK(xMemGetUsed(&size))) {} or
+   *                      if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetIdleUtilization(xHalfWord *utilization_);
+
+
+  /**
+   * @brief Syscall to get where an awaiting task left off
+   *
+   * The xTaskGetAwaitPoint() syscall is used by the TASK_AWAIT_BEGIN() C macro
+   * to obtain where the task's main function left off when it last awaited a
+   * kernel event. It is not normally called directly. The await point is
+   * only kept when CONFIG_TASK_AWAIT_ENABLE is defined, otherwise the syscall
+   * returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskSetAwaitPoint()
+   * @sa xTaskAwaitNotification()
+   * @sa CONFIG_TASK_AWAIT_ENABLE
+   *
+   * @param  task_  The task to be operated on.
+   * @param  point_ Where the task left off, which is zero if it has not awaited
+   *                anything since its main function last ran to the end.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskGetAwaitPoint(const xTask task_, xHalfWord *point_);
+
+
+  /**
+   * @brief Syscall to set where an awaiting task left off
+   *
+   * The xTaskSetAwaitPoint() syscall is used by the TASK_AWAIT_*() C macros to
+   * keep where the task's main function is to carry on from the next time it
+   * is run. It is not normally called directly. The await point is only kept
+   * when CONFIG_TASK_AWAIT_ENABLE is defined, otherwise the syscall returns
+   * ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskGetAwaitPoint()
+   * @sa xTaskAwaitNotification()
+   * @sa CONFIG_TASK_AWAIT_ENABLE
+   *
+   * @param  task_  The task to be operated on.
+   * @param  point_ Where the task is to carry on from, or zero to start from
+   *                the top of its main function.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskSetAwaitPoint(xTask task_, const xHalfWord point_);
+
+
+  /**
+   * @brief Syscall to await a direct to task notification
+   *
+   * The xTaskAwaitNotification() syscall is used to await a direct to task
+   * notification. It is normally used through the TASK_AWAIT_NOTIFICATION() C
+   * macro, which lets a task's main function be written as a stackless
+   * coroutine. The main function starts with TASK_AWAIT_BEGIN(task_) after its
+   * declarations and ends with TASK_AWAIT_END(task_). In between, each of
+   * TASK_AWAIT_NOTIFICATION(), TASK_AWAIT_PERIOD(), TASK_AWAIT_QUEUE() and
+   * TASK_AWAIT_STREAM() returns to the scheduler unless what it awaits has
+   * already happened. The next time the scheduler runs the task, the main
+   * function carries on from that await rather than from the top. Like any
+   * stackless coroutine, local variables do not keep their values across an
+   * await, there can only be one await on a line and an await cannot be
+   * placed inside a switch statement.
+   *
+   * An awaiting task is put in the waiting state and stays there. It is only
+   * run again when it is given a notification, when its task timer elapses or
+   * when what it awaits may have happened, so awaiting does not poll. The
+   * await is checked again each time the task is run. Tasks that await kernel
+   * events are only available when CONFIG_TASK_AWAIT_ENABLE is defined,
+   * otherwise the syscall returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskAwaitPeriod()
+   * @sa xTaskAwaitQueue()
+   * @sa xTaskAwaitStream()
+   * @sa xTaskNotifyTake()
+   * @sa CONFIG_TASK_AWAIT_ENABLE
+   *
+   * @param  task_ The task to be operated on.
+   * @param  res_  True if what the task awaits has happened and the task can
+   *               carry on, false if the task must return to the scheduler and
+   *               be run again later. The notification is left for the task to
+   *               take with xTaskNotifyTake().
+   * @return       On success, the syscall returns ReturnOK. On failure, the
+   *               syscall returns ReturnError. A failure is any condition in
+   *               which the syscall was unable to achieve its intended
+   *               objective. For example, if xTaskGetId() was unable to locate
+   *               the task by the task object (i.e., xTask) passed to the
+   *               syscall, because either the object was null or invalid (e.g.,
+   *               a deleted task), xTaskGetId() would return ReturnError. All
+   *               HeliOS syscalls return the xReturn (a.k.a., Return_t) type
+   *               which can either be ReturnOK or ReturnError. The C macros
+   *               OK() and ERROR() can be used as a more concise way of
+   *               checking the return value of a syscall (e.g.,
+   *               if(OK(xMemGetUsed(&size))) {} or
+   *               if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskAwaitNotification(xTask task_, xBase *res_);
+
+
+  /**
+   * @brief Syscall to await a period of time
+   *
+   * The xTaskAwaitPeriod() syscall is used to await a number of ticks. It is
+   * normally used through the TASK_AWAIT_PERIOD() C macro (see
+   * xTaskAwaitNotification()). The task's task timer is borrowed to wake the
+   * task once the period is up and is stopped again once the await is over,
+   * so a task that awaits a period should not also have a task timer period
+   * of its own. Tasks that await kernel events are only available when
+   * CONFIG_TASK_AWAIT_ENABLE is defined, otherwise the syscall returns
+   * ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskAwaitNotification()
+   * @sa xTaskChangePeriod()
+   * @sa CONFIG_TASK_AWAIT_ENABLE
+   *
+   * @param  task_  The task to be operated on.
+   * @param  ticks_ The number of ticks to await, counted from the first time
+   *                the syscall is called for the await.
+   * @param  res_   True if what the task awaits has happened and the task can
+   *                carry on, false if the task must return to the scheduler and
+   *                be run again later.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskAwaitPeriod(xTask task_, const xTicks ticks_, xBase *res_);
+
+
+  /**
+   * @brief Syscall to await a message in a message queue
+   *
+   * The xTaskAwaitQueue() syscall is used to await a message queue that is
+   * not empty. It is normally used through the TASK_AWAIT_QUEUE() C macro (see
+   * xTaskAwaitNotification()). The task is run again once xQueueSend() sends a
+   * message to the message queue. If the message queue is deleted, the task is
+   * no longer awaiting it but stays in the waiting state. Tasks that await
+   * kernel events are only available when CONFIG_TASK_AWAIT_ENABLE is defined,
+   * otherwise the syscall returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskAwaitNotification()
+   * @sa xQueueReceive()
+   * @sa CONFIG_TASK_AWAIT_ENABLE
+   *
+   * @param  task_  The task to be operated on.
+   * @param  queue_ The message queue to await.
+   * @param  res_   True if what the task awaits has happened and the task can
+   *                carry on, false if the task must return to the scheduler and
+   *                be run again later. The message is left in the message queue
+   *                for the task to receive.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskAwaitQueue(xTask task_, const xQueue queue_, xBase *res_);
+
+
+  /**
+   * @brief Syscall to await bytes in a stream buffer
+   *
+   * The xTaskAwaitStream() syscall is used to await a stream buffer that
+   * holds at least a number of bytes. It is normally used through the
+   * TASK_AWAIT_STREAM() C macro (see xTaskAwaitNotification()). The task is
+   * run again once xStreamSend() brings the stream buffer up to that many
+   * bytes. If the stream buffer is deleted, the task is no longer awaiting it
+   * but stays in the waiting state. Tasks that await kernel events are only
+   * available when CONFIG_TASK_AWAIT_ENABLE is defined, otherwise the syscall
+   * returns ReturnError.
+   *
+   * @sa xReturn
+   * @sa xTaskAwaitNotification()
+   * @sa xStreamReceive()
+   * @sa CONFIG_STREAM_BUFFER_BYTES
+   * @sa CONFIG_TASK_AWAIT_ENABLE
+   *
+   * @param  task_   The task to be operated on.
+   * @param  stream_ The stream buffer to await.
+   * @param  bytes_  The number of bytes to await, which must be between one and
+   *                 CONFIG_STREAM_BUFFER_BYTES (default is 32).
+   * @param  res_    True if what the task awaits has happened and the task can
+   *                 carry on, false if the task must return to the scheduler
+   *                 and be run again later. The bytes are left in the stream
+   *                 buffer for the task to receive.
+   * @return         On success, the syscall returns ReturnOK. On failure, the
+   *                 syscall returns ReturnError. A failure is any condition in
+   *                 which the syscall was unable to achieve its intended
+   *                 objective. For example, if xTaskGetId() was unable to
+   *                 locate the task by the task object (i.e., xTask) passed to
+   *                 the syscall, because either the object was null or invalid
+   *                 (e.g., a deleted task), xTaskGetId() would return
+   *                 ReturnError. All HeliOS syscalls return the xReturn
+   *                 (a.k.a., Return_t) type which can either be ReturnOK or
+   *                 ReturnError. The C macros OK() and ERROR() can be used as a
+   *                 more concise way of checking the return value of a syscall
+   *                 (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                 if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskAwaitStream(xTask task_, const xStreamBuffer stream_, const xHalfWord bytes_, xBase *res_);
+
+
+  /**
+   * @brief Syscall to block a stackful task for a number of ticks
+   *
+   * The xTaskDelay() syscall blocks the stackful task that called it until at
+   * least the number of ticks have passed. While it is blocked, the task is in
+   * the waiting state and the scheduler runs the other tasks. The scheduler
+   * runs the task again once the ticks have passed and xTaskDelay() returns,
+   * with the task back in the state it was in and its task timer as it was.
+   * xTaskDelay() may only be called from a task created by
+   * xTaskCreateStackful(). CONFIG_TASK_STACKFUL_ENABLE must be defined to use
+   * xTaskDelay().
+   *
+   * @sa xReturn
+   * @sa xTaskCreateStackful()
+   * @sa xTaskAwaitPeriod()
+   * @sa CONFIG_TASK_STACKFUL_ENABLE
+   *
+   * @param  ticks_ The number of ticks to block for.
+   * @return        On success, the syscall returns ReturnOK. On failure, the
+   *                syscall returns ReturnError. A failure is any condition in
+   *                which the syscall was unable to achieve its intended
+   *                objective. For example, if xTaskGetId() was unable to locate
+   *                the task by the task object (i.e., xTask) passed to the
+   *                syscall, because either the object was null or invalid
+   *                (e.g., a deleted task), xTaskGetId() would return
+   *                ReturnError. All HeliOS syscalls return the xReturn (a.k.a.,
+   *                Return_t) type which can either be ReturnOK or ReturnError.
+   *                The C macros OK() and ERROR() can be used as a more concise
+   *                way of checking the return value of a syscall (e.g.,
+   *                if(OK(xMemGetUsed(&size))) {} or
+   *                if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTaskDelay(const xTicks ticks_);
+
+
   /**
    * @brief Syscall to create an application timer
    *
@@ -2705,6 +4591,46 @@
   xReturn xTimerCreate(xTimer *timer_, const xTicks period_);
 
 
+  /**
+   * @brief Syscall to create an application timer in caller-owned storage
+   *
+   * The xTimerCreateStatic() syscall is the same as xTimerCreate() except the
+   * application timer is placed in storage owned by the caller instead of
+   * being allocated from the kernel memory region. Once created, the
+   * application timer is used and deleted like any other. Deleting it does not
+   * free the storage, it only means the storage can be used again.
+   *
+   * @sa xReturn
+   * @sa xTimer
+   * @sa xTimerCreate()
+   * @sa xTimerDelete()
+   * @sa xSystemGetStaticSize()
+   *
+   * @param  timer_   The application timer to be operated on.
+   * @param  storage_ Caller-owned storage for the application timer, which must
+   *                  stay valid until the application timer is deleted. It does
+   *                  not need to be aligned.
+   * @param  bytes_   The size of the storage in bytes. It must be at least the
+   *                  size returned by xSystemGetStaticSize() for
+   *                  StaticObjectTimer.
+   * @param  period_  The application timer period, measured in ticks.
+   * @return          On success, the syscall returns ReturnOK. On failure, the
+   *                  syscall returns ReturnError. A failure is any condition in
+   *                  which the syscall was unable to achieve its intended
+   *                  objective. For example, if xTaskGetId() was unable to
+   *                  locate the task by the task object (i.e., xTask) passed to
+   *                  the syscall, because either the object was null or invalid
+   *                  (e.g., a deleted task), xTaskGetId() would return
+   *                  ReturnError. All HeliOS syscalls return the xReturn
+   *                  (a.k.a., Return_t) type which can either be ReturnOK or
+   *                  ReturnError. The C macros OK() and ERROR() can be used as
+   *                  a more concise way of checking the return value of a
+   *                  syscall (e.g., if(OK(xMemGetUsed(&size))) {} or
+   *                  if(ERROR(xMemGetUsed(&size))) {}).
+   */
+  xReturn xTimerCreateStatic(xTimer *timer_, xByte *storage_, const xSize bytes_, const xTicks period_);
+
+
   /**
    * @brief Syscall to delete an application timer
    *
@@ -130,6 +130,50 @@
   #endif /* if !defined(CONFIG_TASK_NAME_BYTES) */
 
 
+/**
+ * @brief Define to enable the task lookup indexes
+ *
+ * Defining CONFIG_TASK_INDEX_ENABLE makes the kernel keep three indexes of the
+ * tasks. Two of them are used by xTaskGetHandleByName() and
+ * xTaskGetHandleById() to find a task without going through every task. The
+ * third is used by every syscall that takes a task to check the task is valid.
+ * Tasks are put in a bucket by a hash of their name, by their ID and by a hash
+ * of the address of their task object. Without the indexes the task list is
+ * walked instead, which is quick enough when there are only a few tasks. The
+ * indexes add three pointers per bucket to the task list and three pointers
+ * and a byte to every task. By default the task lookup indexes are not
+ * enabled.
+ *
+ * @sa CONFIG_TASK_INDEX_BUCKETS
+ * @sa xTaskGetHandleByName()
+ * @sa xTaskGetHandleById()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_INDEX_ENABLE)
+      #define CONFIG_TASK_INDEX_ENABLE
+    #endif /* if !defined(CONFIG_TASK_INDEX_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define the number of buckets in the task lookup indexes
+ *
+ * Setting CONFIG_TASK_INDEX_BUCKETS defines how many buckets there are in each
+ * of the three task indexes. As long as there are no more tasks than buckets,
+ * most lookups look at only one task. Each bucket takes the size of three
+ * pointers in the kernel memory region. This has no effect unless
+ * CONFIG_TASK_INDEX_ENABLE is defined. The value must be between 1 and 255.
+ * The default is 4 buckets.
+ *
+ * @sa CONFIG_TASK_INDEX_ENABLE
+ *
+ */
+  #if !defined(CONFIG_TASK_INDEX_BUCKETS)
+    #define CONFIG_TASK_INDEX_BUCKETS 0x4u /* 4 */
+  #endif /* if !defined(CONFIG_TASK_INDEX_BUCKETS) */
+
+
 /**
  * @brief Define the number of memory blocks available in all memory regions
  *
@@ -167,6 +211,218 @@
   #endif /* if !defined(CONFIG_MEMORY_REGION_BLOCK_SIZE) */
 
 
+/**
+ * @brief Define the placement policy used by the memory regions
+ *
+ * Setting CONFIG_MEMORY_PLACEMENT_POLICY allows the end-user to select how a
+ * free memory entry is chosen to satisfy an allocation in both the heap and
+ * kernel memory regions. Different allocation patterns fragment differently
+ * under each policy so the policy should be chosen to suit the application.
+ * The available policies are:
+ *
+ * MEMORY_PLACEMENT_POLICY_BEST_FIT - Use the free memory entry with the fewest
+ * blocks that can satisfy the allocation.
+ *
+ * MEMORY_PLACEMENT_POLICY_FIRST_FIT - Use the first free memory entry, from the
+ * start of the memory region, that can satisfy the allocation.
+ *
+ * MEMORY_PLACEMENT_POLICY_NEXT_FIT - Use the first free memory entry that can
+ * satisfy the allocation starting from where the previous allocation left off.
+ *
+ * The default policy is MEMORY_PLACEMENT_POLICY_BEST_FIT.
+ *
+ * @sa xMemAlloc()
+ * @sa xMemGetRegionMap()
+ *
+ */
+  #if !defined(CONFIG_MEMORY_PLACEMENT_POLICY)
+    #define CONFIG_MEMORY_PLACEMENT_POLICY MEMORY_PLACEMENT_POLICY_BEST_FIT
+  #endif /* if !defined(CONFIG_MEMORY_PLACEMENT_POLICY) */
+
+
+/**
+ * @brief Define the resolution of the system ticks
+ *
+ * Setting CONFIG_TICK_RESOLUTION selects what a tick is. Task runtimes, task
+ * timers and the scheduler's runtime based fairness are all measured in ticks
+ * so a task that runs for less than a tick appears to take no time at all. The
+ * available resolutions are:
+ *
+ * TICK_RESOLUTION_DEFAULT - A millisecond on Arduino and POSIX and a SysTick
+ * interrupt on ARM Cortex-M.
+ *
+ * TICK_RESOLUTION_MICROSECONDS - A microsecond. On ARM Cortex-M the DWT cycle
+ * counter is divided down by SYSTEM_CORE_CLOCK_FREQUENCY.
+ *
+ * TICK_RESOLUTION_NANOSECONDS - A nanosecond on POSIX and a microsecond,
+ * counted in steps of 1000, on Arduino. It is not supported on ARM Cortex-M.
+ *
+ * TICK_RESOLUTION_CYCLES - A CPU cycle counted by the DWT cycle counter. It is
+ * only supported on ARM Cortex-M.
+ *
+ * POSIX reads CLOCK_MONOTONIC for the microsecond and nanosecond resolutions.
+ * At a higher resolution 32-bit ticks wrap around much sooner so defining
+ * CONFIG_TICKS_64BIT_ENABLE as well is recommended. The default resolution is
+ * TICK_RESOLUTION_DEFAULT.
+ *
+ * @sa CONFIG_TICKS_64BIT_ENABLE
+ *
+ */
+  #if !defined(CONFIG_TICK_RESOLUTION)
+    #define CONFIG_TICK_RESOLUTION TICK_RESOLUTION_DEFAULT
+  #endif /* if !defined(CONFIG_TICK_RESOLUTION) */
+
+
+/**
+ * @brief Define to use 64-bit system ticks
+ *
+ * Defining CONFIG_TICKS_64BIT_ENABLE makes the Ticks_t type 64 bits wide
+ * instead of 32 bits. Total task runtimes then cannot overflow in any
+ * practical amount of time so the scheduler no longer watches for overflow and
+ * never has to reset the total runtimes of all tasks. By default ticks are 32
+ * bits wide.
+ *
+ * @sa CONFIG_TICK_RESOLUTION
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TICKS_64BIT_ENABLE)
+      #define CONFIG_TICKS_64BIT_ENABLE
+    #endif /* if !defined(CONFIG_TICKS_64BIT_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define to enable the buddy memory region
+ *
+ * The CONFIG_MEMORY_BUDDY_REGION_ENABLE setting allows the end-user to enable a
+ * third memory region managed by a buddy allocator. The buddy memory region
+ * only hands out blocks whose size is a power of two and each block is aligned
+ * to its own size, up to CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER, so blocks may
+ * be used as aligned device and DMA buffers. Splitting and merging blocks takes
+ * at most one step per order so allocations and frees complete in O(log n)
+ * time. When enabled, xDeviceRead() and xDeviceWrite() stage device data in the
+ * buddy memory region and device drivers may allocate their own buffers from
+ * it by calling __BuddyAllocateMemory__(). By default the
+ * CONFIG_MEMORY_BUDDY_REGION_ENABLE setting is not defined.
+ *
+ * @sa CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER
+ * @sa CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER
+ * @sa CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER
+ * @sa xMemGetBuddyStats()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+      #define CONFIG_MEMORY_BUDDY_REGION_ENABLE
+    #endif /* if !defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define the size of the smallest block in the buddy memory region
+ *
+ * Setting CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER allows the end-user to define the
+ * size of the smallest block the buddy memory region will hand out as a power
+ * of two (i.e., a value of 5 is 2^5 or 32 bytes). The smallest block must be
+ * large enough to hold the buddy entry used to track free blocks, which is 12
+ * bytes on 32-bit targets and 24 bytes on 64-bit targets. This has no effect
+ * unless CONFIG_MEMORY_BUDDY_REGION_ENABLE is defined. The default is 5.
+ *
+ * @sa CONFIG_MEMORY_BUDDY_REGION_ENABLE
+ *
+ */
+  #if !defined(CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER)
+    #define CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER 0x5u /* 5 */
+  #endif /* if !defined(CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER) */
+
+
+/**
+ * @brief Define the size of the buddy memory region
+ *
+ * Setting CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER allows the end-user to define the
+ * size of the buddy memory region as a power of two (i.e., a value of 10 is
+ * 2^10 or 1024 bytes). This is also the size of the largest block the buddy
+ * memory region can hand out. This has no effect unless
+ * CONFIG_MEMORY_BUDDY_REGION_ENABLE is defined. The default is 10.
+ *
+ * @sa CONFIG_MEMORY_BUDDY_REGION_ENABLE
+ *
+ */
+  #if !defined(CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER)
+    #define CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER 0xAu /* 10 */
+  #endif /* if !defined(CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER) */
+
+
+/**
+ * @brief Define the alignment of blocks in the buddy memory region
+ *
+ * Setting CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER allows the end-user to define,
+ * as a power of two, the largest alignment the buddy memory region guarantees
+ * in absolute terms. Every block is aligned to its own size or to this,
+ * whichever is smaller. Because the compiler does not align the buddy memory
+ * region for us, it takes up to 2^CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER - 1
+ * more bytes of RAM to line it up, so this should be no larger than the
+ * largest alignment a device needs. Values above
+ * CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER are treated as
+ * CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER. This has no effect unless
+ * CONFIG_MEMORY_BUDDY_REGION_ENABLE is defined. The default is
+ * CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER.
+ *
+ * @sa CONFIG_MEMORY_BUDDY_REGION_ENABLE
+ *
+ */
+  #if !defined(CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER)
+    #define CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER
+  #endif /* if !defined(CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER) */
+
+
+/**
+ * @brief Define to skip zeroing the memory regions at start-up
+ *
+ * Defining CONFIG_MEMORY_REGION_LAZY_INIT causes xSystemInit() to only set up
+ * the first memory entry of the heap and kernel memory regions instead of
+ * zeroing out every byte of both. Memory is always zeroed out when it is
+ * allocated, so the only difference is how long xSystemInit() takes. This is
+ * most noticeable with large memory regions or when the memory regions are
+ * placed in external RAM. Because the memory regions are static, the C runtime
+ * has already zeroed them before xSystemInit() is called. By default the
+ * memory regions are zeroed out at start-up.
+ *
+ * @sa CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS
+ * @sa xSystemInit()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_MEMORY_REGION_LAZY_INIT)
+      #define CONFIG_MEMORY_REGION_LAZY_INIT
+    #endif /* if !defined(CONFIG_MEMORY_REGION_LAZY_INIT) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define to enable critical section statistics
+ *
+ * Defining CONFIG_CRITICAL_SECTION_STATS_ENABLE will cause the kernel to time
+ * every critical section (i.e., every time interrupts are disabled) and keep
+ * the number of times, the longest time and a log2 histogram of the time
+ * interrupts were disabled for each critical section. The statistics can be
+ * obtained with xSystemGetCriticalSectionStats(). Timing uses the port's
+ * timestamp which on ARM Cortex-M is the DWT cycle counter. Because timing
+ * adds overhead to every critical section, this should only be defined while
+ * measuring interrupt latency. By default critical section statistics are not
+ * collected.
+ *
+ * @sa xSystemGetCriticalSectionStats()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+      #define CONFIG_CRITICAL_SECTION_STATS_ENABLE
+    #endif /* if !defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
 /**
  * @brief Define the minimum value for a message queue limit
  *
@@ -212,6 +468,438 @@
   #endif /* if !defined(CONFIG_TASK_WD_TIMER_ENABLE) */
 
 
+/**
+ * @brief Define to enable tickless idle
+ *
+ * Defining CONFIG_TICKLESS_IDLE_ENABLE allows the scheduler to put the
+ * processor to sleep when there are no tasks in the running state and no
+ * waiting tasks with a notification. The scheduler sleeps until the next task
+ * timer elapses or, if no waiting task has a task timer, for at most
+ * CONFIG_TICKLESS_IDLE_MAXIMUM_TICKS. On ARM Cortex-M, SysTick is reprogrammed
+ * to skip the ticks in between and the processor waits for an interrupt (WFI),
+ * so any other interrupt will wake it early. The SysTick counter is 24 bits
+ * wide which limits how long one sleep can be. At the higher tick resolutions
+ * SysTick is left alone so the processor wakes at least once a SysTick period.
+ * On POSIX the scheduler sleeps with clock_nanosleep() which a signal
+ * will interrupt. On other architectures the scheduler does not sleep. The
+ * idle hook set by xTaskSetIdleHook() is called and idle time is accounted for
+ * whether or not this is defined. By default tickless idle is not enabled.
+ *
+ * @sa CONFIG_TICKLESS_IDLE_MAXIMUM_TICKS
+ * @sa xTaskSetIdleHook()
+ * @sa xTaskGetIdleTime()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TICKLESS_IDLE_ENABLE)
+      #define CONFIG_TICKLESS_IDLE_ENABLE
+    #endif /* if !defined(CONFIG_TICKLESS_IDLE_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define the longest the scheduler will sleep when idle
+ *
+ * Setting CONFIG_TICKLESS_IDLE_MAXIMUM_TICKS defines the longest time, in
+ * ticks, the scheduler will sleep for at once when idle. This has no effect
+ * unless CONFIG_TICKLESS_IDLE_ENABLE is defined. The default is 1000 ticks.
+ *
+ * @sa CONFIG_TICKLESS_IDLE_ENABLE
+ *
+ */
+  #if !defined(CONFIG_TICKLESS_IDLE_MAXIMUM_TICKS)
+    #define CONFIG_TICKLESS_IDLE_MAXIMUM_TICKS 0x3E8u /* 1000 */
+  #endif /* if !defined(CONFIG_TICKLESS_IDLE_MAXIMUM_TICKS) */
+
+
+/**
+ * @brief Define the number of task priority levels
+ *
+ * Setting CONFIG_TASK_PRIORITY_LEVELS defines how many priority levels tasks
+ * can be given with xTaskCreateWithPriority() or xTaskChangePriority(). The
+ * lowest priority level is zero and the highest is one less than
+ * CONFIG_TASK_PRIORITY_LEVELS. The scheduler always runs tasks in the highest
+ * priority level that has a task in the running state and, within a priority
+ * level, runs the task with the least total runtime. Tasks created with
+ * xTaskCreate() are given priority level zero. The value must be between 1 and
+ * 32. The default is 8 priority levels.
+ *
+ * @sa xTaskCreateWithPriority()
+ * @sa xTaskChangePriority()
+ *
+ */
+  #if !defined(CONFIG_TASK_PRIORITY_LEVELS)
+    #define CONFIG_TASK_PRIORITY_LEVELS 0x8u /* 8 */
+  #endif /* if !defined(CONFIG_TASK_PRIORITY_LEVELS) */
+
+
+/**
+ * @brief Define to enable earliest deadline first scheduling
+ *
+ * Defining CONFIG_TASK_EDF_ENABLE changes the order in which the scheduler
+ * runs waiting tasks whose task timers have elapsed. Normally they are run in
+ * the order their task timers elapsed. With CONFIG_TASK_EDF_ENABLE defined
+ * they are run in order of their deadlines instead. The deadline of a task is
+ * the end of the task timer period that follows the one that just elapsed
+ * (i.e., a task must finish before its task timer would elapse again). The
+ * number of times a task finished after its deadline is counted, whether or
+ * not this is defined, when CONFIG_TASK_RELEASE_STATS_ENABLE is defined. By
+ * default earliest deadline first scheduling is not enabled.
+ *
+ * @sa xTaskChangePeriod()
+ * @sa CONFIG_TASK_RELEASE_STATS_ENABLE
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_EDF_ENABLE)
+      #define CONFIG_TASK_EDF_ENABLE
+    #endif /* if !defined(CONFIG_TASK_EDF_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define to enable task release statistics
+ *
+ * Defining CONFIG_TASK_RELEASE_STATS_ENABLE makes the scheduler count, for
+ * every task with a task timer, how many times the task was released, how
+ * many task timer periods it overran, how many times it finished after its
+ * deadline and how late it was run after its task timer elapsed (i.e., its
+ * release jitter). The statistics are obtained with xTaskGetTaskRunTimeStats()
+ * or xTaskGetAllRunTimeStats() and are zero unless this is defined. By
+ * default task release statistics are not enabled.
+ *
+ * @sa xTaskGetTaskRunTimeStats()
+ * @sa xTaskGetAllRunTimeStats()
+ * @sa xTaskChangeReleasePolicy()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+      #define CONFIG_TASK_RELEASE_STATS_ENABLE
+    #endif /* if !defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define to enable counting and bitwise task notifications
+ *
+ * Defining CONFIG_TASK_NOTIFY_EVENTS_ENABLE allows a task to be given a
+ * counting notification with xTaskNotifyGiveCount() or a bitwise
+ * notification with xTaskNotifyGiveBits(), including from an interrupt with
+ * xTaskNotifyGiveCountFromISR() and xTaskNotifyGiveBitsFromISR(). Unless this
+ * is defined those syscalls, and xTaskNotifyTakeCount() and
+ * xTaskNotifyTakeBits(), always return ReturnError. By default counting and
+ * bitwise task notifications are not enabled.
+ *
+ * @sa xTaskNotifyGiveCount()
+ * @sa xTaskNotifyGiveBits()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+      #define CONFIG_TASK_NOTIFY_EVENTS_ENABLE
+    #endif /* if !defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define to enable task latency histograms
+ *
+ * Defining CONFIG_TASK_HISTOGRAM_ENABLE makes the scheduler keep two log2
+ * histograms for every task. One is of how long the task's main function ran
+ * for each time it was called. The other is of the wake latency of the task,
+ * the time from when a waiting task was due to run (i.e., its task timer
+ * elapsed or it was given a notification) until it was run. The histograms
+ * are obtained with xTaskGetLatencyHistogram(). The histograms add about 256
+ * bytes to every task. By default task latency histograms are not enabled.
+ *
+ * @sa xTaskGetLatencyHistogram()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+      #define CONFIG_TASK_HISTOGRAM_ENABLE
+    #endif /* if !defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define to enable the scheduler event trace
+ *
+ * Defining CONFIG_TRACE_ENABLE makes the scheduler record what it does in a
+ * ring buffer of compact trace events. An event is recorded each time a task
+ * is dispatched and each time it returns, when a waiting task is woken
+ * because its task timer elapsed or it was given a notification, when a task
+ * is suspended or resumed and when a task is suspended by its task watchdog
+ * timer. The trace is obtained with xTaskGetTrace() and can be turned into a
+ * timeline with the tracejson host tool in test/tools. Once the ring buffer is
+ * full, the oldest events are overwritten. By default the scheduler event
+ * trace is not enabled.
+ *
+ * @sa xTaskGetTrace()
+ * @sa xTaskClearTrace()
+ * @sa CONFIG_TRACE_BUFFER_EVENTS
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TRACE_ENABLE)
+      #define CONFIG_TRACE_ENABLE
+    #endif /* if !defined(CONFIG_TRACE_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define the number of events in the scheduler event trace
+ *
+ * Setting CONFIG_TRACE_BUFFER_EVENTS defines how many trace events the ring
+ * buffer holds when CONFIG_TRACE_ENABLE is defined. Each trace event takes
+ * about the size of a tick plus two bytes. The value must be between 1 and
+ * 65535. The default is 128 trace events.
+ *
+ * @sa CONFIG_TRACE_ENABLE
+ *
+ */
+  #if !defined(CONFIG_TRACE_BUFFER_EVENTS)
+    #define CONFIG_TRACE_BUFFER_EVENTS 0x80u /* 128 */
+  #endif /* if !defined(CONFIG_TRACE_BUFFER_EVENTS) */
+
+
+/**
+ * @brief Define to enable sliding window CPU utilization
+ *
+ * Defining CONFIG_TASK_UTILIZATION_ENABLE makes the scheduler keep how much
+ * time each task ran, and how much time the scheduler was idle, over a window
+ * that slides along with the system ticks. Unlike the total runtime of a task,
+ * which only ever grows until it overflows, this answers how much of the CPU a
+ * task used recently and how much headroom is left. The window is made up of
+ * CONFIG_TASK_UTILIZATION_SLOTS slots of CONFIG_TASK_UTILIZATION_SLOT_TICKS
+ * ticks each and slides one slot at a time. The utilization is obtained with
+ * xTaskGetUtilization(), xTaskGetIdleUtilization(), xTaskGetTaskInfo() and
+ * xTaskGetAllTaskInfo(). The window adds the size of a tick for every slot to
+ * every task. By default sliding window CPU utilization is not enabled.
+ *
+ * @sa xTaskGetUtilization()
+ * @sa xTaskGetIdleUtilization()
+ * @sa CONFIG_TASK_UTILIZATION_SLOTS
+ * @sa CONFIG_TASK_UTILIZATION_SLOT_TICKS
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_UTILIZATION_ENABLE)
+      #define CONFIG_TASK_UTILIZATION_ENABLE
+    #endif /* if !defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define the number of slots in the utilization window
+ *
+ * Setting CONFIG_TASK_UTILIZATION_SLOTS defines how many slots make up the
+ * window CPU utilization is measured over when CONFIG_TASK_UTILIZATION_ENABLE
+ * is defined. The slot the scheduler is in is only partly over so the window
+ * covers between one less than CONFIG_TASK_UTILIZATION_SLOTS and
+ * CONFIG_TASK_UTILIZATION_SLOTS slots. More slots make the window slide more
+ * smoothly at the cost of memory. The value must be between 2 and 255. The
+ * default is 4 slots.
+ *
+ * @sa CONFIG_TASK_UTILIZATION_ENABLE
+ *
+ */
+  #if !defined(CONFIG_TASK_UTILIZATION_SLOTS)
+    #define CONFIG_TASK_UTILIZATION_SLOTS 0x4u /* 4 */
+  #endif /* if !defined(CONFIG_TASK_UTILIZATION_SLOTS) */
+
+
+/**
+ * @brief Define the length of a slot in the utilization window
+ *
+ * Setting CONFIG_TASK_UTILIZATION_SLOT_TICKS defines the length in ticks of
+ * each slot of the window CPU utilization is measured over when
+ * CONFIG_TASK_UTILIZATION_ENABLE is defined. The default is 250 ticks which,
+ * with the default of 4 slots and millisecond ticks, gives a window of about
+ * one second.
+ *
+ * @sa CONFIG_TASK_UTILIZATION_ENABLE
+ * @sa CONFIG_TICK_RESOLUTION
+ *
+ */
+  #if !defined(CONFIG_TASK_UTILIZATION_SLOT_TICKS)
+    #define CONFIG_TASK_UTILIZATION_SLOT_TICKS 0xFAu /* 250 */
+  #endif /* if !defined(CONFIG_TASK_UTILIZATION_SLOT_TICKS) */
+
+
+/**
+ * @brief Define to enable tasks that await kernel events
+ *
+ * Defining CONFIG_TASK_AWAIT_ENABLE lets a task's main function be written as
+ * a stackless coroutine with the TASK_AWAIT_BEGIN(), TASK_AWAIT_END() and
+ * TASK_AWAIT_*() C macros. A task awaiting a notification, a period, a message
+ * queue or a stream buffer returns to the scheduler and is not run again until
+ * what it is waiting for may have happened, at which point it carries on from
+ * where it left off. Awaiting adds about the size of a pointer, a tick and six
+ * bytes to every task. By default tasks that await kernel events are not
+ * enabled.
+ *
+ * @sa xTaskAwaitNotification()
+ * @sa xTaskAwaitPeriod()
+ * @sa xTaskAwaitQueue()
+ * @sa xTaskAwaitStream()
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_AWAIT_ENABLE)
+      #define CONFIG_TASK_AWAIT_ENABLE
+    #endif /* if !defined(CONFIG_TASK_AWAIT_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define to enable stackful tasks
+ *
+ * Defining CONFIG_TASK_STACKFUL_ENABLE allows tasks to be created with
+ * xTaskCreateStackful(). A stackful task runs on its own stack so, unlike a
+ * normal task, it can block in the middle of its main function with
+ * xTaskDelay() or xQueueReceiveBlocking() and carry on from there once the
+ * scheduler runs it again. This makes it easier to bring code written for a
+ * blocking API into HeliOS. Stackful tasks are only supported on POSIX
+ * (i.e., POSIX_ARCH_OTHER) where the stack is switched with swapcontext().
+ * Blocking is built on awaiting so defining CONFIG_TASK_STACKFUL_ENABLE also
+ * defines CONFIG_TASK_AWAIT_ENABLE. Normal tasks do not get a stack and cost
+ * only the size of a pointer more. By default stackful tasks are not enabled.
+ *
+ * @sa xTaskCreateStackful()
+ * @sa xTaskDelay()
+ * @sa xQueueReceiveBlocking()
+ * @sa CONFIG_TASK_AWAIT_ENABLE
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_STACKFUL_ENABLE)
+      #define CONFIG_TASK_STACKFUL_ENABLE
+    #endif /* if !defined(CONFIG_TASK_STACKFUL_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+  #if defined(CONFIG_TASK_STACKFUL_ENABLE)
+    #if !defined(CONFIG_TASK_AWAIT_ENABLE)
+      #define CONFIG_TASK_AWAIT_ENABLE
+    #endif /* if !defined(CONFIG_TASK_AWAIT_ENABLE) */
+  #endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+
+/**
+ * @brief Define to enable running tasks on more than one thread
+ *
+ * Defining CONFIG_SCHEDULER_THREADS_ENABLE allows the scheduler to be started
+ * with xTaskStartSchedulerThreads() which runs the tasks on a number of POSIX
+ * threads instead of just the one that started the scheduler. Every syscall
+ * then takes a kernel lock so notifications, message queues, memory and the
+ * rest of the kernel are thread-safe, and a task is never run by two threads
+ * at once. Threads are only supported on POSIX (i.e., POSIX_ARCH_OTHER) and
+ * the application must be linked with -pthread. Because of the kernel lock,
+ * syscalls are a little slower even when only one thread is used. By default
+ * threads are not enabled.
+ *
+ * @sa xTaskStartSchedulerThreads()
+ * @sa CONFIG_SCHEDULER_THREADS_MAXIMUM
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      #define CONFIG_SCHEDULER_THREADS_ENABLE
+    #endif /* if !defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define the most threads the scheduler can run tasks on
+ *
+ * Setting CONFIG_SCHEDULER_THREADS_MAXIMUM will define the most threads that
+ * may be passed to xTaskStartSchedulerThreads(), counting the thread that
+ * starts the scheduler. Each thread has its own run queue which is set aside
+ * statically so this should be no more than needed. The default is 8 threads.
+ *
+ * @sa CONFIG_SCHEDULER_THREADS_ENABLE
+ *
+ */
+  #if !defined(CONFIG_SCHEDULER_THREADS_MAXIMUM)
+    #define CONFIG_SCHEDULER_THREADS_MAXIMUM 0x8u /* 8 */
+  #endif /* if !defined(CONFIG_SCHEDULER_THREADS_MAXIMUM) */
+
+
+/**
+ * @brief Define the number of scheduler instances
+ *
+ * Setting CONFIG_SCHEDULER_CORES will define how many scheduler instances
+ * there are. Each instance has its own ready heaps, timer heap and task state
+ * lists and only runs the tasks pinned to it with xTaskSetAffinity(), so the
+ * tasks on one instance never wait on the tasks of another. When the scheduler
+ * is started with xTaskStartSchedulerCores(), each instance is run on its own
+ * POSIX thread and is otherwise started with xTaskStartScheduler(), which
+ * only runs the first. More than one instance requires the kernel lock so
+ * setting CONFIG_SCHEDULER_CORES to more than one also defines
+ * CONFIG_SCHEDULER_THREADS_ENABLE. The default is one instance unless
+ * CONFIG_SCHEDULER_THREADS_ENABLE is defined, in which case it is four.
+ *
+ * @sa xTaskSetAffinity()
+ * @sa xTaskStartSchedulerCores()
+ *
+ */
+  #if !defined(CONFIG_SCHEDULER_CORES)
+    #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      #define CONFIG_SCHEDULER_CORES 0x4u /* 4 */
+    #else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+      #define CONFIG_SCHEDULER_CORES 0x1u /* 1 */
+    #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  #endif /* if !defined(CONFIG_SCHEDULER_CORES) */
+
+
+  #if CONFIG_SCHEDULER_CORES > 0x1u
+    #if !defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      #define CONFIG_SCHEDULER_THREADS_ENABLE
+    #endif /* if !defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  #endif /* if CONFIG_SCHEDULER_CORES > 0x1u */
+
+
+/**
+ * @brief Define to keep the task list and task heaps out of kernel memory
+ *
+ * Defining CONFIG_TASK_STATIC_HEAPS_ENABLE sets aside the task list and the
+ * scheduler's ready, timer and deadline heaps statically instead of allocating
+ * them from the kernel memory region. Together with xTaskCreateStatic(), this
+ * lets tasks be created without using the kernel memory region at all. The
+ * static heaps cost RAM whether or not tasks are created and no more than
+ * CONFIG_TASK_STATIC_HEAPS_TASKS tasks may be created. By default the task list
+ * and task heaps are allocated from the kernel memory region.
+ *
+ * @sa xTaskCreateStatic()
+ * @sa CONFIG_TASK_STATIC_HEAPS_TASKS
+ *
+ */
+  #if defined(DOXYGEN)
+    #if !defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+      #define CONFIG_TASK_STATIC_HEAPS_ENABLE
+    #endif /* if !defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+  #endif /* if defined(DOXYGEN) */
+
+
+/**
+ * @brief Define the most tasks the static task heaps can hold
+ *
+ * Setting CONFIG_TASK_STATIC_HEAPS_TASKS will define the most tasks that may
+ * be created when CONFIG_TASK_STATIC_HEAPS_ENABLE is defined. Each core has a
+ * heap for every priority level plus the timer heap and, if enabled, the
+ * deadline heap, and each of them holds this many task pointers. The default
+ * is 8 tasks.
+ *
+ * @sa CONFIG_TASK_STATIC_HEAPS_ENABLE
+ *
+ */
+  #if !defined(CONFIG_TASK_STATIC_HEAPS_TASKS)
+    #define CONFIG_TASK_STATIC_HEAPS_TASKS 0x8u /* 8 */
+  #endif /* if !defined(CONFIG_TASK_STATIC_HEAPS_TASKS) */
+
+
 /**
  * @brief Define the length of a device driver name
  *
@@ -97,6 +97,42 @@
   #define MEMORY_REGION_SIZE_IN_BYTES CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS *CONFIG_MEMORY_REGION_BLOCK_SIZE
 
 
+  #if defined(BUDDY_REGION_BLOCK_SIZE)
+    #undef BUDDY_REGION_BLOCK_SIZE
+  #endif /* if defined(BUDDY_REGION_BLOCK_SIZE) */
+  #define BUDDY_REGION_BLOCK_SIZE (((Word_t) 0x1u) << CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER)
+
+
+  #if defined(BUDDY_REGION_SIZE_IN_BYTES)
+    #undef BUDDY_REGION_SIZE_IN_BYTES
+  #endif /* if defined(BUDDY_REGION_SIZE_IN_BYTES) */
+  #define BUDDY_REGION_SIZE_IN_BYTES (((Word_t) 0x1u) << CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER)
+
+
+  #if defined(BUDDY_REGION_SIZE_IN_BLOCKS)
+    #undef BUDDY_REGION_SIZE_IN_BLOCKS
+  #endif /* if defined(BUDDY_REGION_SIZE_IN_BLOCKS) */
+  #define BUDDY_REGION_SIZE_IN_BLOCKS (((Word_t) 0x1u) << (CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER - CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER))
+
+
+  #if defined(BUDDY_REGION_ORDERS)
+    #undef BUDDY_REGION_ORDERS
+  #endif /* if defined(BUDDY_REGION_ORDERS) */
+  #define BUDDY_REGION_ORDERS ((CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER - CONFIG_MEMORY_BUDDY_REGION_MIN_ORDER) + 0x1u)
+
+
+  /* Aligning the buddy memory region to more than its own size would only
+   * waste RAM. */
+  #if defined(BUDDY_REGION_ALIGNMENT)
+    #undef BUDDY_REGION_ALIGNMENT
+  #endif /* if defined(BUDDY_REGION_ALIGNMENT) */
+  #if CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER < CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER
+    #define BUDDY_REGION_ALIGNMENT (((Word_t) 0x1u) << CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER)
+  #else  /* if CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER < CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER */
+    #define BUDDY_REGION_ALIGNMENT BUDDY_REGION_SIZE_IN_BYTES
+  #endif /* if CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER < CONFIG_MEMORY_BUDDY_REGION_MAX_ORDER */
+
+
   #if defined(FLAG_RUNNING)
     #undef FLAG_RUNNING
   #endif /* if defined(FLAG_RUNNING) */
@@ -139,6 +175,31 @@
   #define RET_RETURN return(ret)
 
 
+  #if defined(SYSCALL_DEFINE)
+    #undef SYSCALL_DEFINE
+  #endif /* if defined(SYSCALL_DEFINE) */
+  #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    /* When tasks may run on more than one thread, every syscall holds the
+     * kernel lock from SYSCALL_DEFINE until SYSCALL_RETURN. The kernel's
+     * internal functions use RET_DEFINE and RET_RETURN instead and are called
+     * with the kernel lock held, so the lock is only taken once per syscall. */
+    #define SYSCALL_DEFINE Return_t ret = __PortKernelLock__()
+  #else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    #define SYSCALL_DEFINE Return_t ret = ReturnError
+  #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+  #if defined(SYSCALL_RETURN)
+    #undef SYSCALL_RETURN
+  #endif /* if defined(SYSCALL_RETURN) */
+  #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    #define SYSCALL_RETURN return(__PortKernelUnlock__(ret))
+  #else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    #define SYSCALL_RETURN return(ret)
+  #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
   #if defined(RET_OK)
     #undef RET_OK
   #endif /* if defined(RET_OK) */
@@ -179,6 +240,215 @@
   #define MEMORY_REGION_CHECK_OPTION_W_ADDR 0x2u /* 2 */
 
 
+  #if defined(MEMORY_REGION_ATTEMPTS)
+    #undef MEMORY_REGION_ATTEMPTS
+  #endif /* if defined(MEMORY_REGION_ATTEMPTS) */
+  #define MEMORY_REGION_ATTEMPTS 0x3u /* 3 */
+
+
+  #if defined(TASK_HEAPS)
+    #undef TASK_HEAPS
+  #endif /* if defined(TASK_HEAPS) */
+  #if defined(CONFIG_TASK_EDF_ENABLE)
+    #define TASK_HEAPS 0x3u /* 3 */
+  #else  /* if defined(CONFIG_TASK_EDF_ENABLE) */
+    #define TASK_HEAPS 0x2u /* 2 */
+  #endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+
+
+  /* The fewest tasks a task heap is allocated to hold. Four task pointers fit
+   * in one memory block on most targets so a smaller heap saves nothing. */
+  #if defined(TASK_HEAP_MINIMUM_CAPACITY)
+    #undef TASK_HEAP_MINIMUM_CAPACITY
+  #endif /* if defined(TASK_HEAP_MINIMUM_CAPACITY) */
+  #define TASK_HEAP_MINIMUM_CAPACITY 0x4u /* 4 */
+
+
+  #if defined(TASK_HEAP_READY)
+    #undef TASK_HEAP_READY
+  #endif /* if defined(TASK_HEAP_READY) */
+  #define TASK_HEAP_READY 0x0u /* 0 */
+
+
+  #if defined(TASK_HEAP_TIMER)
+    #undef TASK_HEAP_TIMER
+  #endif /* if defined(TASK_HEAP_TIMER) */
+  #define TASK_HEAP_TIMER 0x1u /* 1 */
+
+
+  #if defined(TASK_HEAP_DEADLINE)
+    #undef TASK_HEAP_DEADLINE
+  #endif /* if defined(TASK_HEAP_DEADLINE) */
+  #define TASK_HEAP_DEADLINE 0x2u /* 2 */
+
+
+  #if defined(TASK_PRIORITY)
+    #undef TASK_PRIORITY
+  #endif /* if defined(TASK_PRIORITY) */
+  #if CONFIG_TASK_PRIORITY_LEVELS > 0x1u
+    #define TASK_PRIORITY(task_) ((task_)->priority)
+  #else  /* if CONFIG_TASK_PRIORITY_LEVELS > 0x1u */
+    #define TASK_PRIORITY(task_) zero
+  #endif /* if CONFIG_TASK_PRIORITY_LEVELS > 0x1u */
+
+
+  #if defined(TASK_CORE)
+    #undef TASK_CORE
+  #endif /* if defined(TASK_CORE) */
+  #if CONFIG_SCHEDULER_CORES > 0x1u
+    #define TASK_CORE(task_) ((task_)->core)
+  #else  /* if CONFIG_SCHEDULER_CORES > 0x1u */
+    #define TASK_CORE(task_) zero
+  #endif /* if CONFIG_SCHEDULER_CORES > 0x1u */
+
+
+  #if defined(CRITICAL_SITES)
+    #undef CRITICAL_SITES
+  #endif /* if defined(CRITICAL_SITES) */
+  #define CRITICAL_SITES 0x6u /* 6 */
+
+
+  #if defined(CRITICAL_SECTION_HISTOGRAM_BUCKETS)
+    #undef CRITICAL_SECTION_HISTOGRAM_BUCKETS
+  #endif /* if defined(CRITICAL_SECTION_HISTOGRAM_BUCKETS) */
+  #define CRITICAL_SECTION_HISTOGRAM_BUCKETS 0x10u /* 16 */
+
+
+  #if defined(TASK_HISTOGRAMS)
+    #undef TASK_HISTOGRAMS
+  #endif /* if defined(TASK_HISTOGRAMS) */
+  #define TASK_HISTOGRAMS 0x2u /* 2 */
+
+
+  #if defined(TASK_HISTOGRAM_BUCKETS)
+    #undef TASK_HISTOGRAM_BUCKETS
+  #endif /* if defined(TASK_HISTOGRAM_BUCKETS) */
+  #define TASK_HISTOGRAM_BUCKETS 0x20u /* 32 */
+
+
+  #if defined(AWAIT_NONE)
+    #undef AWAIT_NONE
+  #endif /* if defined(AWAIT_NONE) */
+  #define AWAIT_NONE 0x0u /* 0 */
+
+
+  #if defined(AWAIT_PERIOD)
+    #undef AWAIT_PERIOD
+  #endif /* if defined(AWAIT_PERIOD) */
+  #define AWAIT_PERIOD 0x1u /* 1 */
+
+
+  #if defined(AWAIT_OBJECT)
+    #undef AWAIT_OBJECT
+  #endif /* if defined(AWAIT_OBJECT) */
+  #define AWAIT_OBJECT 0x2u /* 2 */
+
+
+  #if defined(AWAIT_READY)
+    #undef AWAIT_READY
+  #endif /* if defined(AWAIT_READY) */
+  #define AWAIT_READY 0x3u /* 3 */
+
+
+  #if defined(STACKFUL_STACK_MINIMUM_BYTES)
+    #undef STACKFUL_STACK_MINIMUM_BYTES
+  #endif /* if defined(STACKFUL_STACK_MINIMUM_BYTES) */
+  #define STACKFUL_STACK_MINIMUM_BYTES 0x2000u /* 8192 */
+
+
+  #if defined(EXECUTOR_QUEUE_SLOTS)
+    #undef EXECUTOR_QUEUE_SLOTS
+  #endif /* if defined(EXECUTOR_QUEUE_SLOTS) */
+  #define EXECUTOR_QUEUE_SLOTS 0x40u /* 64 */
+
+
+  #if defined(CORE_WAIT_NANOSECONDS)
+    #undef CORE_WAIT_NANOSECONDS
+  #endif /* if defined(CORE_WAIT_NANOSECONDS) */
+  #define CORE_WAIT_NANOSECONDS 0xF4240u /* 1000000 */
+
+
+  #if defined(STATIC_OBJECTS)
+    #undef STATIC_OBJECTS
+  #endif /* if defined(STATIC_OBJECTS) */
+  #define STATIC_OBJECTS 0x4u /* 4 */
+
+
+  #if defined(STATIC_OBJECT_ALIGNMENT)
+    #undef STATIC_OBJECT_ALIGNMENT
+  #endif /* if defined(STATIC_OBJECT_ALIGNMENT) */
+  #define STATIC_OBJECT_ALIGNMENT 0x8u /* 8 */
+
+
+  /* Caller-owned storage for a kernel object holds a static entry, aligned to
+   * STATIC_OBJECT_ALIGNMENT, followed by the object. The storage itself does
+   * not need to be aligned so allow for the worst case. */
+  #if defined(STATIC_OBJECT_BYTES)
+    #undef STATIC_OBJECT_BYTES
+  #endif /* if defined(STATIC_OBJECT_BYTES) */
+  #define STATIC_OBJECT_BYTES(size_) ((size_) + (2u * STATIC_OBJECT_ALIGNMENT) - 1u)
+
+
+  #if defined(MEMORY_PLACEMENT_POLICY_BEST_FIT)
+    #undef MEMORY_PLACEMENT_POLICY_BEST_FIT
+  #endif /* if defined(MEMORY_PLACEMENT_POLICY_BEST_FIT) */
+  #define MEMORY_PLACEMENT_POLICY_BEST_FIT 0x1u /* 1 */
+
+
+  #if defined(MEMORY_PLACEMENT_POLICY_FIRST_FIT)
+    #undef MEMORY_PLACEMENT_POLICY_FIRST_FIT
+  #endif /* if defined(MEMORY_PLACEMENT_POLICY_FIRST_FIT) */
+  #define MEMORY_PLACEMENT_POLICY_FIRST_FIT 0x2u /* 2 */
+
+
+  #if defined(MEMORY_PLACEMENT_POLICY_NEXT_FIT)
+    #undef MEMORY_PLACEMENT_POLICY_NEXT_FIT
+  #endif /* if defined(MEMORY_PLACEMENT_POLICY_NEXT_FIT) */
+  #define MEMORY_PLACEMENT_POLICY_NEXT_FIT 0x3u /* 3 */
+
+
+  #if defined(TICK_RESOLUTION_DEFAULT)
+    #undef TICK_RESOLUTION_DEFAULT
+  #endif /* if defined(TICK_RESOLUTION_DEFAULT) */
+  #define TICK_RESOLUTION_DEFAULT 0x1u /* 1 */
+
+
+  #if defined(TICK_RESOLUTION_MICROSECONDS)
+    #undef TICK_RESOLUTION_MICROSECONDS
+  #endif /* if defined(TICK_RESOLUTION_MICROSECONDS) */
+  #define TICK_RESOLUTION_MICROSECONDS 0x2u /* 2 */
+
+
+  #if defined(TICK_RESOLUTION_NANOSECONDS)
+    #undef TICK_RESOLUTION_NANOSECONDS
+  #endif /* if defined(TICK_RESOLUTION_NANOSECONDS) */
+  #define TICK_RESOLUTION_NANOSECONDS 0x3u /* 3 */
+
+
+  #if defined(TICK_RESOLUTION_CYCLES)
+    #undef TICK_RESOLUTION_CYCLES
+  #endif /* if defined(TICK_RESOLUTION_CYCLES) */
+  #define TICK_RESOLUTION_CYCLES 0x4u /* 4 */
+
+
+  #if defined(BUDDY2INDEX)
+    #undef BUDDY2INDEX
+  #endif /* if defined(BUDDY2INDEX) */
+  #define BUDDY2INDEX(addr_, region_) ((HalfWord_t) ((((const volatile Byte_t *) (addr_)) - (region_)->base) / BUDDY_REGION_BLOCK_SIZE))
+
+
+  #if defined(INDEX2BUDDY)
+    #undef INDEX2BUDDY
+  #endif /* if defined(INDEX2BUDDY) */
+  #define INDEX2BUDDY(index_, region_) ((BuddyEntry_t *) ((region_)->base + ((index_) * BUDDY_REGION_BLOCK_SIZE)))
+
+
+  #if defined(BUDDY_BYTES)
+    #undef BUDDY_BYTES
+  #endif /* if defined(BUDDY_BYTES) */
+  #define BUDDY_BYTES(order_) (BUDDY_REGION_BLOCK_SIZE << (order_))
+
+
   #if defined(ADDR2ENTRY)
     #undef ADDR2ENTRY
   #endif /* if defined(ADDR2ENTRY) */
@@ -211,6 +481,12 @@
   #define UINT32_TYPE uint32_t
 
 
+  #if defined(UINT64_TYPE)
+    #undef UINT64_TYPE
+  #endif /* if defined(UINT64_TYPE) */
+  #define UINT64_TYPE uint64_t
+
+
   #if defined(SIZE_TYPE)
     #undef SIZE_TYPE
   #endif /* if defined(SIZE_TYPE) */
@@ -229,6 +505,72 @@
   #define DEREF_TASKPARM(type_, ptr_) (*((type_ *) (ptr_)))
 
 
+  /* The TASK_AWAIT_*() C macros turn a task's main function into a stackless
+   * coroutine that picks up where it left off (see xTaskAwaitNotification()).
+   * Where to pick up is kept as the line number of the await so there can be
+   * no more than one await on a line. */
+  #if defined(TASK_AWAIT_BEGIN)
+    #undef TASK_AWAIT_BEGIN
+  #endif /* if defined(TASK_AWAIT_BEGIN) */
+  #define TASK_AWAIT_BEGIN(task_) \
+          { \
+            HalfWord_t taskAwaitPoint = zero; \
+            Base_t taskAwaitReady = false; \
+            xTaskGetAwaitPoint((task_), &taskAwaitPoint); \
+            switch(taskAwaitPoint) { \
+              case zero:
+
+
+  #if defined(TASK_AWAIT_UNTIL)
+    #undef TASK_AWAIT_UNTIL
+  #endif /* if defined(TASK_AWAIT_UNTIL) */
+  #define TASK_AWAIT_UNTIL(task_, await_) \
+          do { \
+            if(OK(xTaskSetAwaitPoint((task_), __LINE__))) { \
+              case __LINE__: \
+                taskAwaitReady = false; \
+                if(!OK(await_) || (false == taskAwaitReady)) { \
+                  return; \
+                } \
+            } else { \
+              return; \
+            } \
+          } while(0)
+
+
+  #if defined(TASK_AWAIT_NOTIFICATION)
+    #undef TASK_AWAIT_NOTIFICATION
+  #endif /* if defined(TASK_AWAIT_NOTIFICATION) */
+  #define TASK_AWAIT_NOTIFICATION(task_) TASK_AWAIT_UNTIL((task_), xTaskAwaitNotification((task_), &taskAwaitReady))
+
+
+  #if defined(TASK_AWAIT_PERIOD)
+    #undef TASK_AWAIT_PERIOD
+  #endif /* if defined(TASK_AWAIT_PERIOD) */
+  #define TASK_AWAIT_PERIOD(task_, ticks_) TASK_AWAIT_UNTIL((task_), xTaskAwaitPeriod((task_), (ticks_), &taskAwaitReady))
+
+
+  #if defined(TASK_AWAIT_QUEUE)
+    #undef TASK_AWAIT_QUEUE
+  #endif /* if defined(TASK_AWAIT_QUEUE) */
+  #define TASK_AWAIT_QUEUE(task_, queue_) TASK_AWAIT_UNTIL((task_), xTaskAwaitQueue((task_), (queue_), &taskAwaitReady))
+
+
+  #if defined(TASK_AWAIT_STREAM)
+    #undef TASK_AWAIT_STREAM
+  #endif /* if defined(TASK_AWAIT_STREAM) */
+  #define TASK_AWAIT_STREAM(task_, stream_, bytes_) TASK_AWAIT_UNTIL((task_), xTaskAwaitStream((task_), (stream_), (bytes_), &taskAwaitReady))
+
+
+  #if defined(TASK_AWAIT_END)
+    #undef TASK_AWAIT_END
+  #endif /* if defined(TASK_AWAIT_END) */
+  #define TASK_AWAIT_END(task_) \
+          } \
+          xTaskSetAwaitPoint((task_), zero); \
+          }
+
+
   #if defined(CONCAT)
     #undef CONCAT
   #endif /* if defined(CONCAT) */
@@ -262,7 +604,7 @@
   #if defined(CALCMAGIC)
     #undef CALCMAGIC
   #endif /* if defined(CALCMAGIC) */
-  #define CALCMAGIC(ptr_) (((Word_t) (ptr_)) ^ MAGIC_CONST)
+  #define CALCMAGIC(ptr_) (((Word_t) ((Size_t) (ptr_))) ^ MAGIC_CONST)
 
 
   #if defined(OKMAGIC)
@@ -290,4 +632,22 @@
   #define FREE 0xD5u /* 213 */
 
 
+  #if defined(BUDDY_INUSE)
+    #undef BUDDY_INUSE
+  #endif /* if defined(BUDDY_INUSE) */
+  #define BUDDY_INUSE 0x80u /* 128 */
+
+
+  #if defined(BUDDY_FREE)
+    #undef BUDDY_FREE
+  #endif /* if defined(BUDDY_FREE) */
+  #define BUDDY_FREE 0x40u /* 64 */
+
+
+  #if defined(BUDDY_ORDER_MASK)
+    #undef BUDDY_ORDER_MASK
+  #endif /* if defined(BUDDY_ORDER_MASK) */
+  #define BUDDY_ORDER_MASK 0x3Fu /* 63 */
+
+
 #endif /* ifndef DEFINES_H_ */
\ No newline at end of file
@@ -21,7 +21,7 @@ static Return_t __DeviceListFind__(const HalfWord_t uid_, Device_t **device_);
 
 
 Return_t xDeviceRegisterDevice(Return_t (*device_self_register_)()) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(device_self_register_)) {
     /* Call the device driver's DEVICENAME_self_register() function which will
@@ -35,7 +35,7 @@ Return_t xDeviceRegisterDevice(Return_t (*device_self_register_)()) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
@@ -131,7 +131,7 @@ Return_t __RegisterDevice__(const HalfWord_t uid_, const Byte_t *name_, const De
 
 
 Return_t xDeviceIsAvailable(const HalfWord_t uid_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Device_t *device = null;
@@ -159,12 +159,12 @@ Return_t xDeviceIsAvailable(const HalfWord_t uid_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xDeviceSimpleWrite(const HalfWord_t uid_, Byte_t data_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Device_t *device = null;
@@ -197,12 +197,12 @@ Return_t xDeviceSimpleWrite(const HalfWord_t uid_, Byte_t data_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xDeviceWrite(const HalfWord_t uid_, Size_t *size_, Addr_t *data_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Device_t *device = null;
@@ -220,19 +220,19 @@ Return_t xDeviceWrite(const HalfWord_t uid_, Size_t *size_, Addr_t *data_) {
           /* Check to make sure the device is running *AND*
            * writable. */
           if(((DeviceModeReadWrite == device->mode) || (DeviceModeWriteOnly == device->mode)) && (DeviceStateRunning == device->state)) {
-            /* Allocate some kernel memory we will copy the data to be written
-             * to the device from the heap into. */
-            if(OK(__KernelAllocateMemory__((volatile Addr_t **) &data, *size_))) {
+            /* Allocate a staging buffer we will copy the data to be written to
+             * the device from the heap into. */
+            if(OK(__DeviceAllocateMemory__((volatile Addr_t **) &data, *size_))) {
               if(NOTNULLPTR(data)) {
                 /* Copy the data to be written to the device from the heap into
-                 * the kernel memory then call the device driver's
+                 * the staging buffer then call the device driver's
                  * DEVICENAME_write() function. */
                 if(OK(__memcpy__(data, data_, *size_))) {
                   if(OK((*device->write)(device, size_, data))) {
-                    /* Free the kernel memory now that we are done. It is up to
+                    /* Free the staging buffer now that we are done. It is up to
                      * the end-user to free the heap memory the data occupies.
                      */
-                    if(OK(__KernelFreeMemory__(data))) {
+                    if(OK(__DeviceFreeMemory__(data))) {
                       device->bytesWritten += *size_;
                       RET_OK;
                     } else {
@@ -243,16 +243,16 @@ Return_t xDeviceWrite(const HalfWord_t uid_, Size_t *size_, Addr_t *data_) {
 
 
                     /* Because DEVICENAME_write() returned an error, we need to
-                     * free the kernel memory. */
-                    __KernelFreeMemory__(data);
+                     * free the staging buffer. */
+                    __DeviceFreeMemory__(data);
                   }
                 } else {
                   ASSERT;
 
 
                   /* Because __memcpy__() returned an error, we need to free the
-                   * kernel memory. */
-                  __KernelFreeMemory__(data);
+                   * staging buffer. */
+                  __DeviceFreeMemory__(data);
                 }
               } else {
                 ASSERT;
@@ -276,12 +276,12 @@ Return_t xDeviceWrite(const HalfWord_t uid_, Size_t *size_, Addr_t *data_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xDeviceSimpleRead(const HalfWord_t uid_, Byte_t *data_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Device_t *device = null;
@@ -319,12 +319,12 @@ Return_t xDeviceSimpleRead(const HalfWord_t uid_, Byte_t *data_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xDeviceRead(const HalfWord_t uid_, Size_t *size_, Addr_t **data_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Device_t *device = null;
@@ -340,22 +340,23 @@ Return_t xDeviceRead(const HalfWord_t uid_, Size_t *size_, Addr_t **data_) {
          * readable. */
         if(((DeviceModeReadWrite == device->mode) || (DeviceModeReadOnly == device->mode)) && (DeviceStateRunning == device->state)) {
           /* Call the device driver's DEVICENAME_read() function and check that
-           * the data returned by the device driver is waiting for us in kernel
-           * memory. */
+           * the data returned by the device driver is waiting for us in a
+           * staging buffer. */
           if(OK((*device->read)(device, size_, &data))) {
             if((zero < *size_) && NOTNULLPTR(data)) {
-              if(OK(__MemoryRegionCheckKernel__(data, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+              if(OK(__MemoryRegionCheckDevice__(data, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
                 /* Allocate "size_" of heap memory to copy the data read from
-                 * the device in kernel memory into. */
+                 * the device in the staging buffer into. */
                 if(OK(__HeapAllocateMemory__((volatile Addr_t **) data_, *size_))) {
                   if(NOTNULLPTR(*data_)) {
-                    /* Perform the copy from kernel memory to heap memory. */
+                    /* Perform the copy from the staging buffer to heap memory.
+                     */
                     if(OK(__memcpy__(*data_, data, *size_))) {
-                      /* Free the kernel memory now that we are done. It is up
+                      /* Free the staging buffer now that we are done. It is up
                        * to the end-user to free the heap memory the data
                        * occupies.
                        */
-                      if(OK(__KernelFreeMemory__(data))) {
+                      if(OK(__DeviceFreeMemory__(data))) {
                         device->bytesRead += *size_;
                         RET_OK;
                       }
@@ -364,8 +365,8 @@ Return_t xDeviceRead(const HalfWord_t uid_, Size_t *size_, Addr_t **data_) {
 
 
                       /* Because __memcpy__() returned an error, we need to free
-                       * the kernel memory. */
-                      __KernelFreeMemory__(data);
+                       * the staging buffer. */
+                      __DeviceFreeMemory__(data);
 
 
                       /* Because __memcpy__() returned an error, we also need to
@@ -377,16 +378,16 @@ Return_t xDeviceRead(const HalfWord_t uid_, Size_t *size_, Addr_t **data_) {
 
 
                     /* Because __HeapAllocateMemory__() returned a null pointer,
-                     * we need to free the kernel memory. */
-                    __KernelFreeMemory__(data);
+                     * we need to free the staging buffer. */
+                    __DeviceFreeMemory__(data);
                   }
                 } else {
                   ASSERT;
 
 
                   /* Because __HeapAllocateMemory__() returned an error, we need
-                   * to free the kernel memory. */
-                  __KernelFreeMemory__(data);
+                   * to free the staging buffer. */
+                  __DeviceFreeMemory__(data);
                 }
               } else {
                 ASSERT;
@@ -410,7 +411,7 @@ Return_t xDeviceRead(const HalfWord_t uid_, Size_t *size_, Addr_t **data_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
@@ -446,7 +447,7 @@ static Return_t __DeviceListFind__(const HalfWord_t uid_, Device_t **device_) {
 
 
 Return_t xDeviceInitDevice(const HalfWord_t uid_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Device_t *device = null;
@@ -477,12 +478,12 @@ Return_t xDeviceInitDevice(const HalfWord_t uid_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xDeviceConfigDevice(const HalfWord_t uid_, Size_t *size_, Addr_t *config_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Device_t *device = null;
@@ -564,7 +565,7 @@ Return_t xDeviceConfigDevice(const HalfWord_t uid_, Size_t *size_, Addr_t *confi
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
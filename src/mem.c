@@ -156,23 +156,53 @@
 /*UNCRUSTIFY-ON*/
 static volatile MemoryRegion_t heap;
 static volatile MemoryRegion_t kernel;
+static StaticEntry_t *statics = null;
 static Return_t __MemoryRegionCheck__(const volatile MemoryRegion_t *region_, const volatile Addr_t *addr_, const Base_t option_);
 static Return_t __calloc__(volatile MemoryRegion_t *region_, volatile Addr_t **addr_, const Size_t size_);
 static Return_t __free__(volatile MemoryRegion_t *region_, const volatile Addr_t *addr_);
 static Return_t __MemGetRegionStats__(const volatile MemoryRegion_t *region_, MemoryRegionStats_t **stats_);
-static Return_t __DefragMemoryRegion__(const volatile MemoryRegion_t *region_);
+static Return_t __MemGetRegionMap__(const volatile MemoryRegion_t *region_, MemoryRegionMapEntry_t *map_, const HalfWord_t size_, HalfWord_t *entries_);
+static void __MergeMemoryEntry__(volatile MemoryRegion_t *region_, MemoryEntry_t *entry_);
 static Return_t __MemoryRegionInit__(volatile MemoryRegion_t *region_);
+static StaticEntry_t *__StaticEntryFind__(const volatile Addr_t *addr_, StaticEntry_t **previous_);
+
+
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+  static volatile BuddyRegion_t buddy;
+  static Return_t __BuddyRegionCheck__(const volatile BuddyRegion_t *region_, const volatile Addr_t *addr_, const Base_t option_);
+  static Return_t __BuddyCalloc__(volatile BuddyRegion_t *region_, volatile Addr_t **addr_, const Size_t size_);
+  static Return_t __BuddyFree__(volatile BuddyRegion_t *region_, const volatile Addr_t *addr_);
+  static void __BuddyLink__(volatile BuddyRegion_t *region_, BuddyEntry_t *entry_, const Base_t order_);
+  static void __BuddyUnlink__(volatile BuddyRegion_t *region_, BuddyEntry_t *entry_, const Base_t order_);
+  static Return_t __BuddyRegionInit__(volatile BuddyRegion_t *region_);
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
 
 
 Return_t __MemoryInit__(void) {
   RET_DEFINE;
 
 
+  /* Forget about any caller-owned storage from before. */
+  statics = null;
+
+
   /* Initialize the heap and kernel memory regions. */
   if(OK(__MemoryRegionInit__(&heap))) {
     if(OK(__MemoryRegionInit__(&kernel))) {
-      FLAG_MEMFAULT = false;
-      RET_OK;
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+
+        /* Initialize the buddy memory region. */
+        if(OK(__BuddyRegionInit__(&buddy))) {
+          FLAG_MEMFAULT = false;
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+
+#else  /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+        FLAG_MEMFAULT = false;
+        RET_OK;
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
     } else {
       ASSERT;
     }
@@ -185,7 +215,7 @@ Return_t __MemoryInit__(void) {
 
 
 Return_t xMemAlloc(volatile Addr_t **addr_, const Size_t size_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(addr_) && (zero < size_)) {
     /* Simply passthrough the address pointer and size parameters to
@@ -200,12 +230,12 @@ Return_t xMemAlloc(volatile Addr_t **addr_, const Size_t size_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xMemFree(const volatile Addr_t *addr_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(addr_)) {
     /* Simply passthrough the address pointer to __free__() for the heap memory
@@ -219,12 +249,12 @@ Return_t xMemFree(const volatile Addr_t *addr_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xMemGetUsed(Size_t *size_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   MemoryEntry_t *cursor = null;
@@ -261,12 +291,12 @@ Return_t xMemGetUsed(Size_t *size_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xMemGetSize(const volatile Addr_t *addr_, Size_t *size_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   MemoryEntry_t *tosize = null;
@@ -297,7 +327,7 @@ Return_t xMemGetSize(const volatile Addr_t *addr_, Size_t *size_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
@@ -508,6 +538,10 @@ static Return_t __MemoryRegionCheck__(const volatile MemoryRegion_t *region_, co
 static Return_t __MemoryRegionInit__(volatile MemoryRegion_t *region_) {
   RET_DEFINE;
 
+
+  Size_t clear = zero;
+
+
   if(NOTNULLPTR(region_)) {
     /* Set the start of the region. */
     region_->start = (MemoryEntry_t *) region_->mem;
@@ -516,6 +550,12 @@ static Return_t __MemoryRegionInit__(volatile MemoryRegion_t *region_) {
     /* Set the starting value of minimum available ever to the size, in bytes,
      * of the memory region. */
     region_->minAvailableEver = MEMORY_REGION_SIZE_IN_BYTES;
+    region_->freeBlocks = CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS;
+
+#if CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_NEXT_FIT
+      region_->rover = region_->start;
+#endif /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+        * MEMORY_PLACEMENT_POLICY_NEXT_FIT */
 
 
     /* Calculate the size of a memory entry in blocks. */
@@ -529,9 +569,20 @@ static Return_t __MemoryRegionInit__(volatile MemoryRegion_t *region_) {
     }
 
 
+#if defined(CONFIG_MEMORY_REGION_LAZY_INIT)
+
+      /* Only the blocks used by the first memory entry need to be zeroed out.
+       * The rest of the memory region is zeroed out by __calloc__() as it is
+       * allocated so there is no need to touch it now. */
+      clear = region_->entrySize * CONFIG_MEMORY_REGION_BLOCK_SIZE;
+#else  /* if defined(CONFIG_MEMORY_REGION_LAZY_INIT) */
+      clear = MEMORY_REGION_SIZE_IN_BYTES;
+#endif /* if defined(CONFIG_MEMORY_REGION_LAZY_INIT) */
+
+
     /* Zero out the memory region and create the first memory entry and give it
      * all of the blocks.*/
-    if(OK(__memset__(region_->mem, zero, MEMORY_REGION_SIZE_IN_BYTES))) {
+    if(OK(__memset__(region_->mem, zero, clear))) {
       /* CALCMAGIC() calculates the memory entry's magic value (i.e. the magic
        * member of the memory entry structure) by XOR'ing the address of the
        * memory entry with the MAGIC_CONST. The magic value is used by
@@ -555,65 +606,142 @@ static Return_t __MemoryRegionInit__(volatile MemoryRegion_t *region_) {
 
 static Return_t __calloc__(volatile MemoryRegion_t *region_, volatile Addr_t **addr_, const Size_t size_) {
   RET_DEFINE;
+  CRITICAL_DEFINE;
 
 
   HalfWord_t requested = zero;
-  HalfWord_t free = zero;
+  HalfWord_t version = zero;
+  Base_t attempt = zero;
+  Base_t memfault = false;
+  Base_t committed = false;
+
 
+#if CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_BEST_FIT
 
-  /* Intentionally underflow the unsigned type so we get the max value of a
-   * HalfWord_t. */
-  HalfWord_t fewest = -1;
+    /* Intentionally underflow the unsigned type so we get the max value of a
+     * HalfWord_t. */
+    HalfWord_t fewest = -1;
+#endif /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+        * MEMORY_PLACEMENT_POLICY_BEST_FIT */
   MemoryEntry_t *cursor = null;
   MemoryEntry_t *candidate = null;
   MemoryEntry_t *next = null;
 
 
-  /* Because we are modifying memory entries, we need to disable interrupts
-   * until __calloc__() is done. */
-  DISABLE_INTERRUPTS();
-
   if(NOTNULLPTR(region_) && NOTNULLPTR(addr_) && (zero < size_)) {
-    /* Check the consistency of the memory region before we modify anything. */
-    if(OK(__MemoryRegionCheck__(region_, null, MEMORY_REGION_CHECK_OPTION_WO_ADDR))) {
-      /* Because the user supplied requested memory in bytes, calculate how many
-       * blocks have been requested. */
-      requested = ((HalfWord_t) (size_ / CONFIG_MEMORY_REGION_BLOCK_SIZE));
+    /* Because the user supplied requested memory in bytes, calculate how many
+     * blocks have been requested. */
+    requested = ((HalfWord_t) (size_ / CONFIG_MEMORY_REGION_BLOCK_SIZE));
+
+    if(zero < ((HalfWord_t) (size_ % CONFIG_MEMORY_REGION_BLOCK_SIZE))) {
+      requested++;
+    }
 
-      if(zero < ((HalfWord_t) (size_ % CONFIG_MEMORY_REGION_BLOCK_SIZE))) {
-        requested++;
+
+    /* Add the number of blocks(s) required by the memory entry to the
+     * requested blocks. This is the total number of free blocks that will be
+     * needed. */
+    requested += region_->entrySize;
+
+
+    /* Checking the memory region and searching it for a candidate entry are
+     * done with interrupts enabled. Every change to the memory entries bumps
+     * the memory region's version, so if the version is the same once
+     * interrupts are disabled, nothing changed underneath us and the candidate
+     * can be committed. If something did change, start over. */
+    for(attempt = zero; (attempt < MEMORY_REGION_ATTEMPTS) && (false == committed); attempt++) {
+      version = region_->version;
+      memfault = FLAG_MEMFAULT;
+      candidate = null;
+
+      /* Check the consistency of the memory region before we modify anything.
+       */
+      if(!OK(__MemoryRegionCheck__(region_, null, MEMORY_REGION_CHECK_OPTION_WO_ADDR))) {
+        /* If the memory region changed while it was being checked, the check
+         * may have seen it half-way through the change so don't let it set the
+         * memfault flag. */
+        if(version != region_->version) {
+          FLAG_MEMFAULT = memfault;
+          continue;
+        }
+
+        ASSERT;
+        break;
       }
 
+#if CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_FIRST_FIT
+        cursor = region_->start;
 
-      /* Add the number of blocks(s) required by the memory entry to the
-       * requested blocks. This is the total number of free blocks that will be
-       * needed. */
-      requested += region_->entrySize;
-      cursor = region_->start;
+        while(NOTNULLPTR(cursor) && OKADDR(region_, cursor)) {
+          /* The first entry that is free *AND* contains enough blocks to
+           * cover the request is the candidate. */
+          if((FREE == cursor->free) && (requested <= cursor->blocks)) {
+            candidate = cursor;
+            break;
+          }
 
-      while(NOTNULLPTR(cursor)) {
-        /* See if we have a possible candidate entry to use for the requested
-         * blocks. To be a candidate the entry must:
-         *  1. Be free.
-         *  2. Must contain enough blocks to cover the request.
-         *  3. Must be an entry with the fewest blocks (this is to reduce
-         * fragmentation). */
-        if((FREE == cursor->free) && (requested <= cursor->blocks) && (fewest > cursor->blocks)) {
-          fewest = cursor->blocks;
-          candidate = cursor;
+          cursor = cursor->next;
+        }
+
+#elif CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_NEXT_FIT
+        cursor = region_->rover;
+
+        /* Start looking where the previous allocation left off and wrap around
+         * to the start of the memory region until we are back where we
+         * started. The first entry that is free *AND* contains enough blocks
+         * to cover the request is the candidate. */
+        do {
+          if((FREE == cursor->free) && (requested <= cursor->blocks)) {
+            candidate = cursor;
+            break;
+          }
+
+          cursor = cursor->next;
+
+          if(NULLPTR(cursor) || !OKADDR(region_, cursor)) {
+            cursor = region_->start;
+          }
+        } while(cursor != region_->rover);
+
+#else  /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+        * MEMORY_PLACEMENT_POLICY_FIRST_FIT */
+        cursor = region_->start;
+        fewest = -1;
+
+        while(NOTNULLPTR(cursor) && OKADDR(region_, cursor)) {
+          /* See if we have a possible candidate entry to use for the requested
+           * blocks. To be a candidate the entry must:
+           *  1. Be free.
+           *  2. Must contain enough blocks to cover the request.
+           *  3. Must be an entry with the fewest blocks (this is to reduce
+           * fragmentation). */
+          if((FREE == cursor->free) && (requested <= cursor->blocks) && (fewest > cursor->blocks)) {
+            fewest = cursor->blocks;
+            candidate = cursor;
+          }
+
+          cursor = cursor->next;
         }
 
+#endif /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+        * MEMORY_PLACEMENT_POLICY_FIRST_FIT */
 
-        /* Keep track of how many free blocks remain as we need to update the
-         * statistics for the memory region later. */
-        if(FREE == cursor->free) {
-          free += cursor->blocks;
+      if(NULLPTR(candidate)) {
+        /* If the memory region changed while we were searching it, there may
+         * be a candidate after all. */
+        if(version != region_->version) {
+          continue;
         }
 
-        cursor = cursor->next;
+        break;
       }
 
-      if(NOTNULLPTR(candidate)) {
+
+      /* Because we are modifying memory entries, we need to disable interrupts
+       * until the candidate has been committed. */
+      ENTER_CRITICAL(CriticalSiteMemAlloc);
+
+      if(version == region_->version) {
         /* If the candidate entry contains enough blocks for a memory entry and
          * at least one additional block then we are going to split the memory
          * entry into two. If not, we will just go ahead and use the memory
@@ -639,48 +767,55 @@ static Return_t __calloc__(volatile MemoryRegion_t *region_, volatile Addr_t **a
           /* We split the unneeded blocks off into a new entry, now let's mark
            * the entry containing the blocks in-use for the requested memory. */
           candidate->magic = CALCMAGIC(candidate);
-          candidate->free = INUSE;
           candidate->blocks = requested;
+        }
 
 
-          /* Zero out all of the requested blocks (excluding the memory entry).
-           */
-          if(OK(__memset__(ENTRY2ADDR(candidate, region_), zero, (requested - region_->entrySize) * CONFIG_MEMORY_REGION_BLOCK_SIZE))) {
-            /* ENTRY2ADDR() does the opposite of ADDR2ENTRY(), it converts the
-             * memory entry address to the address of the first block after the
-             * memory entry. */
-            *addr_ = ENTRY2ADDR(candidate, region_);
-            RET_OK;
-          } else {
-            ASSERT;
-          }
-        } else {
-          /* Because we didn't need to split an entry into two, we just need to
-           * mark the entry as in-use and that's it. */
-          candidate->free = INUSE;
-
-
-          /* Zero out all of the requested blocks (excluding the memory
-           * entry).*/
-          if(OK(__memset__(ENTRY2ADDR(candidate, region_), zero, (requested - region_->entrySize) * CONFIG_MEMORY_REGION_BLOCK_SIZE))) {
-            /* ENTRY2ADDR() does the opposite of ADDR2ENTRY(), it converts the
-             * memory entry address to the address of the first block after the
-             * memory entry. */
-            *addr_ = ENTRY2ADDR(candidate, region_);
-            RET_OK;
-          } else {
-            ASSERT;
-          }
-        }
+        /* Whether or not the entry was split, mark it in-use. */
+        candidate->free = INUSE;
 
 
-        /* Update the statistics for the memory region before we are done. */
+        /* Update the statistics for the memory region before we are done. The
+         * candidate's blocks are used here, not the requested blocks, because
+         * an entry that was not split is handed out whole. */
         region_->allocations++;
-        free -= requested;
+        region_->freeBlocks -= candidate->blocks;
 
-        if((free * CONFIG_MEMORY_REGION_BLOCK_SIZE) < region_->minAvailableEver) {
-          region_->minAvailableEver = (free * CONFIG_MEMORY_REGION_BLOCK_SIZE);
+        if((region_->freeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE) < region_->minAvailableEver) {
+          region_->minAvailableEver = (region_->freeBlocks * CONFIG_MEMORY_REGION_BLOCK_SIZE);
         }
+
+#if CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_NEXT_FIT
+
+          /* The next search starts with the entry following the one we just
+           * handed out. */
+          if(NOTNULLPTR(candidate->next)) {
+            region_->rover = candidate->next;
+          } else {
+            region_->rover = region_->start;
+          }
+
+#endif /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+        * MEMORY_PLACEMENT_POLICY_NEXT_FIT */
+        region_->version++;
+        committed = true;
+      }
+
+
+      /* The candidate is committed (or we are starting over) so re-enable
+       * interrupts. */
+      EXIT_CRITICAL(CriticalSiteMemAlloc);
+    }
+
+    if(true == committed) {
+      /* The entry now belongs to the caller so the requested blocks (excluding
+       * the memory entry) can be zeroed out with interrupts enabled. */
+      if(OK(__memset__(ENTRY2ADDR(candidate, region_), zero, (candidate->blocks - region_->entrySize) * CONFIG_MEMORY_REGION_BLOCK_SIZE))) {
+        /* ENTRY2ADDR() does the opposite of ADDR2ENTRY(), it converts the
+         * memory entry address to the address of the first block after the
+         * memory entry. */
+        *addr_ = ENTRY2ADDR(candidate, region_);
+        RET_OK;
       } else {
         ASSERT;
       }
@@ -691,42 +826,96 @@ static Return_t __calloc__(volatile MemoryRegion_t *region_, volatile Addr_t **a
     ASSERT;
   }
 
-
-  /* __calloc__() is done so re-enable interrupts. */
-  ENABLE_INTERRUPTS();
   RET_RETURN;
 }
 
 
 static Return_t __free__(volatile MemoryRegion_t *region_, const volatile Addr_t *addr_) {
   RET_DEFINE;
+  CRITICAL_DEFINE;
 
 
+  HalfWord_t version = zero;
+  Base_t attempt = zero;
+  Base_t memfault = false;
+  Base_t committed = false;
   MemoryEntry_t *free = null;
+  MemoryEntry_t *previous = null;
+  MemoryEntry_t *cursor = null;
 
 
-  /* Because we are modifying memory entries, we need to disable interrupts
-   * until __free__() is done. */
-  DISABLE_INTERRUPTS();
-
   if(NOTNULLPTR(region_) && NOTNULLPTR(addr_)) {
-    /* Check the consistency of the heap memory region *AND* check the address
-     * pointer to ensure it is pointing to a valid block of heap memory. */
-    if(OK(__MemoryRegionCheck__(region_, addr_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    /* Like __calloc__(), the checking and searching is done with interrupts
+     * enabled and the change is only committed if the memory region's version
+     * is unchanged once interrupts are disabled. */
+    for(attempt = zero; (attempt < MEMORY_REGION_ATTEMPTS) && (false == committed); attempt++) {
+      version = region_->version;
+      memfault = FLAG_MEMFAULT;
+
+      /* Check the consistency of the heap memory region *AND* check the
+       * address pointer to ensure it is pointing to a valid block of heap
+       * memory. */
+      if(!OK(__MemoryRegionCheck__(region_, addr_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+        if(version != region_->version) {
+          FLAG_MEMFAULT = memfault;
+          continue;
+        }
+
+        ASSERT;
+        break;
+      }
+
+
       /* ADDR2ENTRY() calculates the location of the memory entry for the
        * allocated memory pointed to by the address pointer. */
       free = ADDR2ENTRY(addr_, region_);
-      free->free = FREE;
-      region_->frees++;
 
 
-      /* After freeing memory, call __DefragMemoryRegion__() to consolidate any
-       * adjacent free blocks. */
-      if(OK(__DefragMemoryRegion__(region_))) {
-        RET_OK;
-      } else {
-        ASSERT;
+      /* Because free entries are always merged as soon as they are freed, the
+       * only entries that could need merging are the ones on either side of
+       * the entry being freed. Find the one before it now, while interrupts are
+       * still enabled. */
+      previous = null;
+      cursor = region_->start;
+
+      while(NOTNULLPTR(cursor) && OKADDR(region_, cursor) && (cursor != free)) {
+        previous = cursor;
+        cursor = cursor->next;
+      }
+
+
+      /* Because we are modifying memory entries, we need to disable interrupts
+       * until the free has been committed. */
+      ENTER_CRITICAL(CriticalSiteMemFree);
+
+      if(version == region_->version) {
+        free->free = FREE;
+        region_->frees++;
+        region_->freeBlocks += free->blocks;
+
+
+        /* Merge the freed entry with the entries on either side of it if they
+         * are free too. */
+        if(NOTNULLPTR(free->next) && (FREE == free->next->free)) {
+          __MergeMemoryEntry__(region_, free);
+        }
+
+        if(NOTNULLPTR(previous) && (FREE == previous->free)) {
+          __MergeMemoryEntry__(region_, previous);
+        }
+
+        region_->version++;
+        committed = true;
       }
+
+
+      /* The free is committed (or we are starting over) so re-enable
+       * interrupts. */
+      EXIT_CRITICAL(CriticalSiteMemFree);
+    }
+
+    if(true == committed) {
+      RET_OK;
     } else {
       ASSERT;
     }
@@ -734,9 +923,6 @@ static Return_t __free__(volatile MemoryRegion_t *region_, const volatile Addr_t
     ASSERT;
   }
 
-
-  /* __free__() is done so re-enable interrupts. */
-  ENABLE_INTERRUPTS();
   RET_RETURN;
 }
 
@@ -802,14 +988,25 @@ Return_t __MemoryRegionCheckKernel__(const volatile Addr_t *addr_, const Base_t
 }
 
 
-Return_t __HeapAllocateMemory__(volatile Addr_t **addr_, const Size_t size_) {
+Return_t __StaticAllocateMemory__(volatile Addr_t **addr_, Byte_t *storage_, const Size_t bytes_, const Size_t size_) {
   RET_DEFINE;
 
-  if(NOTNULLPTR(addr_) && (zero < size_)) {
-    /* Simply passthrough the address pointer to __calloc__() for the heap
-     * memory region and the size of the requested memory. */
-    if(OK(__calloc__(&heap, addr_, size_))) {
-      if(NOTNULLPTR(*addr_)) {
+
+  Size_t offset = zero;
+  StaticEntry_t *entry = null;
+
+
+  if(NOTNULLPTR(addr_) && NOTNULLPTR(storage_) && (zero < size_) && (STATIC_OBJECT_BYTES(size_) <= bytes_)) {
+    /* Line the static entry up on STATIC_OBJECT_ALIGNMENT, the object goes
+     * right after it. */
+    offset = (STATIC_OBJECT_ALIGNMENT - (((Size_t) storage_) % STATIC_OBJECT_ALIGNMENT)) % STATIC_OBJECT_ALIGNMENT;
+    entry = (StaticEntry_t *) (storage_ + offset);
+
+    if(NULLPTR(__StaticEntryFind__(((Byte_t *) entry) + STATIC_OBJECT_ALIGNMENT, null))) {
+      if(OK(__memset__(entry, 0x0, STATIC_OBJECT_ALIGNMENT + size_))) {
+        entry->next = statics;
+        statics = entry;
+        *addr_ = ((Byte_t *) entry) + STATIC_OBJECT_ALIGNMENT;
         RET_OK;
       } else {
         ASSERT;
@@ -825,13 +1022,29 @@ Return_t __HeapAllocateMemory__(volatile Addr_t **addr_, const Size_t size_) {
 }
 
 
-Return_t __HeapFreeMemory__(const volatile Addr_t *addr_) {
+Return_t __KernelObjectFree__(const volatile Addr_t *addr_) {
   RET_DEFINE;
 
+
+  StaticEntry_t *entry = null;
+  StaticEntry_t *previous = null;
+
+
   if(NOTNULLPTR(addr_)) {
-    /* Simply passthrough the address pointer to __free__() for the heap memory
-     * region. */
-    if(OK(__free__(&heap, addr_))) {
+    entry = __StaticEntryFind__(addr_, &previous);
+
+
+    /* Caller-owned storage is given back by just forgetting about it, anything
+     * else came from the kernel memory region. */
+    if(NOTNULLPTR(entry)) {
+      if(NOTNULLPTR(previous)) {
+        previous->next = entry->next;
+      } else {
+        statics = entry->next;
+      }
+
+      RET_OK;
+    } else if(OK(__KernelFreeMemory__(addr_))) {
       RET_OK;
     } else {
       ASSERT;
@@ -844,13 +1057,13 @@ Return_t __HeapFreeMemory__(const volatile Addr_t *addr_) {
 }
 
 
-Return_t __MemoryRegionCheckHeap__(const volatile Addr_t *addr_, const Base_t option_) {
+Return_t __KernelObjectCheck__(const volatile Addr_t *addr_) {
   RET_DEFINE;
 
-  if((NULLPTR(addr_) && (MEMORY_REGION_CHECK_OPTION_WO_ADDR == option_)) || (NOTNULLPTR(addr_) && (MEMORY_REGION_CHECK_OPTION_W_ADDR == option_))) {
-    /* Simply passthrough the address pointer to __MemoryRegionCheck__() for the
-     * heap memory region and the region check option. */
-    if(OK(__MemoryRegionCheck__(&heap, addr_, option_))) {
+  if(NOTNULLPTR(addr_)) {
+    if(NOTNULLPTR(__StaticEntryFind__(addr_, null))) {
+      RET_OK;
+    } else if(OK(__MemoryRegionCheckKernel__(addr_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
       RET_OK;
     } else {
       ASSERT;
@@ -863,85 +1076,41 @@ Return_t __MemoryRegionCheckHeap__(const volatile Addr_t *addr_, const Base_t op
 }
 
 
-Return_t __memcpy__(const volatile Addr_t *dest_, const volatile Addr_t *src_, const Size_t size_) {
-  RET_DEFINE;
-
-
-  Size_t i = zero;
-  volatile Byte_t *src = null;
-  volatile Byte_t *dest = null;
-
-
-  if(NOTNULLPTR(dest_) && NOTNULLPTR(src_) && (zero < size_)) {
-    src = (Byte_t *) src_;
-    dest = (Byte_t *) dest_;
+static StaticEntry_t *__StaticEntryFind__(const volatile Addr_t *addr_, StaticEntry_t **previous_) {
+  StaticEntry_t *cursor = statics;
+  StaticEntry_t *previous = null;
 
-    for(i = zero; i < size_; i++) {
-      dest[i] = src[i];
-    }
 
-    RET_OK;
-  } else {
-    ASSERT;
+  /* Only the addresses are compared so an address that is not a kernel object
+   * is never dereferenced. */
+  while(NOTNULLPTR(cursor) && ((((Byte_t *) cursor) + STATIC_OBJECT_ALIGNMENT) != (const volatile Byte_t *) addr_)) {
+    previous = cursor;
+    cursor = cursor->next;
   }
 
-  RET_RETURN;
-}
-
-
-Return_t __memset__(const volatile Addr_t *dest_, const Byte_t val_, const Size_t size_) {
-  RET_DEFINE;
-
-
-  Size_t i = zero;
-  volatile Byte_t *dest = null;
-
-
-  if(NOTNULLPTR(dest_) && (zero < size_)) {
-    dest = (Byte_t *) dest_;
-
-    for(i = zero; i < size_; i++) {
-      dest[i] = (Byte_t) val_;
-    }
-
-    RET_OK;
-  } else {
-    ASSERT;
+  if(NOTNULLPTR(previous_)) {
+    *previous_ = previous;
   }
 
-  RET_RETURN;
+  return(cursor);
 }
 
 
-Return_t __memcmp__(const volatile Addr_t *s1_, const volatile Addr_t *s2_, const Size_t size_, Base_t *res_) {
+Return_t __HeapAllocateMemory__(volatile Addr_t **addr_, const Size_t size_) {
   RET_DEFINE;
 
-
-  Size_t i = zero;
-  volatile Byte_t *s1 = null;
-  volatile Byte_t *s2 = null;
-
-
-  if(NOTNULLPTR(s1_) && NOTNULLPTR(s2_) && (zero < size_) && NOTNULLPTR(res_)) {
-    /* Set res_ to true by default which indicates the memory is comparable. If
-     * we later discover the memory is *NOT* comparable, we will set res_ to
-     * false. */
-    *res_ = true;
-    s1 = (Byte_t *) s1_;
-    s2 = (Byte_t *) s2_;
-
-    for(i = zero; i < size_; i++) {
-      if(*s1 != *s2) {
-        /* The memory is *NOT* comparable so set res_ to false. */
-        *res_ = false;
-        break;
+  if(NOTNULLPTR(addr_) && (zero < size_)) {
+    /* Simply passthrough the address pointer to __calloc__() for the heap
+     * memory region and the size of the requested memory. */
+    if(OK(__calloc__(&heap, addr_, size_))) {
+      if(NOTNULLPTR(*addr_)) {
+        RET_OK;
+      } else {
+        ASSERT;
       }
-
-      s1++;
-      s2++;
+    } else {
+      ASSERT;
     }
-
-    RET_OK;
   } else {
     ASSERT;
   }
@@ -950,13 +1119,13 @@ Return_t __memcmp__(const volatile Addr_t *s1_, const volatile Addr_t *s2_, cons
 }
 
 
-Return_t xMemGetHeapStats(MemoryRegionStats_t **stats_) {
+Return_t __HeapFreeMemory__(const volatile Addr_t *addr_) {
   RET_DEFINE;
 
-  if(NOTNULLPTR(stats_)) {
-    /* Simply passthrough the address pointer to __MemGetRegionStats__() for the
-     * heap memory region and a pointer to the stats structure. */
-    if(OK(__MemGetRegionStats__(&heap, stats_))) {
+  if(NOTNULLPTR(addr_)) {
+    /* Simply passthrough the address pointer to __free__() for the heap memory
+     * region. */
+    if(OK(__free__(&heap, addr_))) {
       RET_OK;
     } else {
       ASSERT;
@@ -969,13 +1138,13 @@ Return_t xMemGetHeapStats(MemoryRegionStats_t **stats_) {
 }
 
 
-Return_t xMemGetKernelStats(MemoryRegionStats_t **stats_) {
+Return_t __MemoryRegionCheckHeap__(const volatile Addr_t *addr_, const Base_t option_) {
   RET_DEFINE;
 
-  if(NOTNULLPTR(stats_)) {
-    /* Simply passthrough the address pointer to __MemGetRegionStats__() for the
-     * kernel memory region and a pointer to the stats structure. */
-    if(OK(__MemGetRegionStats__(&kernel, stats_))) {
+  if((NULLPTR(addr_) && (MEMORY_REGION_CHECK_OPTION_WO_ADDR == option_)) || (NOTNULLPTR(addr_) && (MEMORY_REGION_CHECK_OPTION_W_ADDR == option_))) {
+    /* Simply passthrough the address pointer to __MemoryRegionCheck__() for the
+     * heap memory region and the region check option. */
+    if(OK(__MemoryRegionCheck__(&heap, addr_, option_))) {
       RET_OK;
     } else {
       ASSERT;
@@ -988,15 +1157,319 @@ Return_t xMemGetKernelStats(MemoryRegionStats_t **stats_) {
 }
 
 
-static Return_t __MemGetRegionStats__(const volatile MemoryRegion_t *region_, MemoryRegionStats_t **stats_) {
+Return_t __DeviceAllocateMemory__(volatile Addr_t **addr_, const Size_t size_) {
   RET_DEFINE;
 
+  if(NOTNULLPTR(addr_) && (zero < size_)) {
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
 
-  MemoryEntry_t *cursor = null;
-
-
-  if(NOTNULLPTR(region_) && NOTNULLPTR(stats_)) {
-    /* Check the memory region consistency before we calculate the statistics
+      /* Device data is staged in the buddy memory region when it is enabled.
+       * Requests larger than the buddy memory region fall back to the kernel
+       * memory region. */
+      if((BUDDY_REGION_SIZE_IN_BYTES >= size_) && OK(__BuddyAllocateMemory__(addr_, size_))) {
+        RET_OK;
+      } else if(OK(__KernelAllocateMemory__(addr_, size_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#else  /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+
+      /* Without the buddy memory region, device data is staged in the kernel
+       * memory region. */
+      if(OK(__KernelAllocateMemory__(addr_, size_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+Return_t __DeviceFreeMemory__(const volatile Addr_t *addr_) {
+  RET_DEFINE;
+
+  if(NOTNULLPTR(addr_)) {
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+
+      /* Free the staging buffer back to whichever memory region it came from.
+       * Device drivers that still stage data in the kernel memory region
+       * themselves keep working. */
+      if(((const volatile Byte_t *) addr_ >= buddy.base) && ((const volatile Byte_t *) addr_ < (buddy.base + BUDDY_REGION_SIZE_IN_BYTES))) {
+        if(OK(__BuddyFreeMemory__(addr_))) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else if(OK(__KernelFreeMemory__(addr_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#else  /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+      if(OK(__KernelFreeMemory__(addr_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+Return_t __MemoryRegionCheckDevice__(const volatile Addr_t *addr_, const Base_t option_) {
+  RET_DEFINE;
+
+  if(NOTNULLPTR(addr_) && (MEMORY_REGION_CHECK_OPTION_W_ADDR == option_)) {
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+
+      /* A staging buffer may be in either the buddy or the kernel memory
+       * region. */
+      if(((const volatile Byte_t *) addr_ >= buddy.base) && ((const volatile Byte_t *) addr_ < (buddy.base + BUDDY_REGION_SIZE_IN_BYTES))) {
+        if(OK(__BuddyRegionCheck__(&buddy, addr_, option_))) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else if(OK(__MemoryRegionCheck__(&kernel, addr_, option_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#else  /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+      if(OK(__MemoryRegionCheck__(&kernel, addr_, option_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+Return_t __memcpy__(const volatile Addr_t *dest_, const volatile Addr_t *src_, const Size_t size_) {
+  RET_DEFINE;
+
+
+  Size_t i = zero;
+  volatile Byte_t *src = null;
+  volatile Byte_t *dest = null;
+
+
+  if(NOTNULLPTR(dest_) && NOTNULLPTR(src_) && (zero < size_)) {
+    src = (Byte_t *) src_;
+    dest = (Byte_t *) dest_;
+
+    for(i = zero; i < size_; i++) {
+      dest[i] = src[i];
+    }
+
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+Return_t __memset__(const volatile Addr_t *dest_, const Byte_t val_, const Size_t size_) {
+  RET_DEFINE;
+
+
+  Size_t i = zero;
+  volatile Byte_t *dest = null;
+
+
+  if(NOTNULLPTR(dest_) && (zero < size_)) {
+    dest = (Byte_t *) dest_;
+
+    for(i = zero; i < size_; i++) {
+      dest[i] = (Byte_t) val_;
+    }
+
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+Return_t __memcmp__(const volatile Addr_t *s1_, const volatile Addr_t *s2_, const Size_t size_, Base_t *res_) {
+  RET_DEFINE;
+
+
+  Size_t i = zero;
+  volatile Byte_t *s1 = null;
+  volatile Byte_t *s2 = null;
+
+
+  if(NOTNULLPTR(s1_) && NOTNULLPTR(s2_) && (zero < size_) && NOTNULLPTR(res_)) {
+    /* Set res_ to true by default which indicates the memory is comparable. If
+     * we later discover the memory is *NOT* comparable, we will set res_ to
+     * false. */
+    *res_ = true;
+    s1 = (Byte_t *) s1_;
+    s2 = (Byte_t *) s2_;
+
+    for(i = zero; i < size_; i++) {
+      if(*s1 != *s2) {
+        /* The memory is *NOT* comparable so set res_ to false. */
+        *res_ = false;
+        break;
+      }
+
+      s1++;
+      s2++;
+    }
+
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+Return_t xMemGetHeapStats(MemoryRegionStats_t **stats_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(stats_)) {
+    /* Simply passthrough the address pointer to __MemGetRegionStats__() for the
+     * heap memory region and a pointer to the stats structure. */
+    if(OK(__MemGetRegionStats__(&heap, stats_))) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xMemGetKernelStats(MemoryRegionStats_t **stats_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(stats_)) {
+    /* Simply passthrough the address pointer to __MemGetRegionStats__() for the
+     * kernel memory region and a pointer to the stats structure. */
+    if(OK(__MemGetRegionStats__(&kernel, stats_))) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xMemGetBuddyStats(MemoryRegionStats_t **stats_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+
+
+    HalfWord_t index = zero;
+    Word_t bytes = zero;
+
+
+    if(NOTNULLPTR(stats_)) {
+      /* Check the buddy memory region consistency before we calculate the
+       * statistics for the buddy memory region. */
+      if(OK(__BuddyRegionCheck__(&buddy, null, MEMORY_REGION_CHECK_OPTION_WO_ADDR))) {
+        /* Allocate some heap memory to hold the memory region statistics
+         * structure. */
+        if(OK(__HeapAllocateMemory__((volatile Addr_t **) stats_, sizeof(MemoryRegionStats_t)))) {
+          /* We intentionally underflow a word (an unsigned type) to get its
+           * maximum value. */
+          (*stats_)->smallestFreeEntryInBytes = -1;
+
+
+          /* Copy in the statistics we already have from the buddy memory
+           * region. */
+          (*stats_)->successfulAllocations = buddy.allocations;
+          (*stats_)->successfulFrees = buddy.frees;
+          (*stats_)->minimumEverFreeBytesRemaining = buddy.minAvailableEver;
+          (*stats_)->availableSpaceInBytes = buddy.available;
+          (*stats_)->numberOfFreeBlocks = buddy.available / BUDDY_REGION_BLOCK_SIZE;
+
+
+          /* Only the first block of every buddy block has its order recorded
+           * so we can hop from one buddy block to the next. */
+          while(BUDDY_REGION_SIZE_IN_BLOCKS > index) {
+            bytes = BUDDY_BYTES(buddy.blocks[index] & BUDDY_ORDER_MASK);
+
+            if(BUDDY_FREE & buddy.blocks[index]) {
+              if((*stats_)->largestFreeEntryInBytes < bytes) {
+                (*stats_)->largestFreeEntryInBytes = bytes;
+              }
+
+              if((*stats_)->smallestFreeEntryInBytes > bytes) {
+                (*stats_)->smallestFreeEntryInBytes = bytes;
+              }
+            }
+
+            index += (HalfWord_t) (bytes / BUDDY_REGION_BLOCK_SIZE);
+          }
+
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+
+    /* The buddy memory region is not enabled so there are no statistics to
+     * get. */
+    ASSERT;
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+static Return_t __MemGetRegionStats__(const volatile MemoryRegion_t *region_, MemoryRegionStats_t **stats_) {
+  RET_DEFINE;
+
+
+  MemoryEntry_t *cursor = null;
+
+
+  if(NOTNULLPTR(region_) && NOTNULLPTR(stats_)) {
+    /* Check the memory region consistency before we calculate the statistics
      * for the memory region. */
     if(OK(__MemoryRegionCheck__(region_, null, MEMORY_REGION_CHECK_OPTION_WO_ADDR))) {
       /* Allocate some heap memory to hold the memory region statistics
@@ -1057,64 +1530,500 @@ static Return_t __MemGetRegionStats__(const volatile MemoryRegion_t *region_, Me
 }
 
 
-static Return_t __DefragMemoryRegion__(const volatile MemoryRegion_t *region_) {
+Return_t xMemGetRegionMap(const MemoryRegionId_t region_, MemoryRegionMapEntry_t *map_, const HalfWord_t size_, HalfWord_t *entries_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(map_) && (zero < size_) && NOTNULLPTR(entries_)) {
+    /* Unlike xMemGetHeapStats() and xMemGetKernelStats(), the map is copied
+     * into a buffer owned by the caller. Allocating the map from the heap would
+     * change the very layout the caller is trying to capture. */
+    if(MemoryRegionHeap == region_) {
+      if(OK(__MemGetRegionMap__(&heap, map_, size_, entries_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else if(MemoryRegionKernel == region_) {
+      if(OK(__MemGetRegionMap__(&kernel, map_, size_, entries_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+static Return_t __MemGetRegionMap__(const volatile MemoryRegion_t *region_, MemoryRegionMapEntry_t *map_, const HalfWord_t size_, HalfWord_t *entries_) {
   RET_DEFINE;
 
 
+  HalfWord_t entries = zero;
   MemoryEntry_t *cursor = null;
-  MemoryEntry_t *merge = null;
 
 
-  if(NOTNULLPTR(region_)) {
-    /* Check the memory region consistency before we attempt to defrag the
-     * memory region. */
+  if(NOTNULLPTR(region_) && NOTNULLPTR(map_) && (zero < size_) && NOTNULLPTR(entries_)) {
+    /* Check the memory region consistency before we walk the memory entries
+     * to build the map. */
     if(OK(__MemoryRegionCheck__(region_, null, MEMORY_REGION_CHECK_OPTION_WO_ADDR))) {
       cursor = region_->start;
 
       while(NOTNULLPTR(cursor)) {
-        /* We will merge the blocks from two adjacent memory entries if:
-         *  1. The cursor is pointing to an entry.
-         *  2. "next" points to an entry.
-         *  3. The entry pointed to be the cursor is free.
-         *  4. The entry pointed to be "next" is free. */
-        if(NOTNULLPTR(cursor) && NOTNULLPTR(cursor->next) && (FREE == cursor->free) && (FREE == cursor->next->free)) {
-          merge = cursor->next;
+        /* Only copy as many memory entries as the caller's buffer can hold but
+         * keep counting so the caller can tell the map was truncated. */
+        if(entries < size_) {
+          /* The offset is given in blocks from the start of the memory region
+           * so it shares the same unit as the blocks member. */
+          map_[entries].offset = (HalfWord_t) (((Byte_t *) cursor - (Byte_t *) region_->mem) / CONFIG_MEMORY_REGION_BLOCK_SIZE);
+          map_[entries].blocks = cursor->blocks;
+
+          if(FREE == cursor->free) {
+            map_[entries].free = true;
+          } else {
+            map_[entries].free = false;
+          }
+        }
 
+        entries++;
+        cursor = cursor->next;
+      }
+
+      *entries_ = entries;
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+static void __MergeMemoryEntry__(volatile MemoryRegion_t *region_, MemoryEntry_t *entry_) {
+  MemoryEntry_t *merge = entry_->next;
+
+
+  /* CALCMAGIC() calculates the memory entry's magic value (i.e. the magic
+   * member of the memory entry structure) by XOR'ing the address of the memory
+   * entry with the MAGIC_CONST. The magic value is used by
+   * __MemoryRegionCheck__() to check the consistency of the memory region. */
+  entry_->magic = CALCMAGIC(entry_);
+  entry_->blocks += merge->blocks;
+  entry_->next = merge->next;
+
+#if CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_NEXT_FIT
+
+    /* Don't leave the roving pointer on an entry that no longer exists. */
+    if(region_->rover == merge) {
+      region_->rover = entry_;
+    }
+
+#endif /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+        * MEMORY_PLACEMENT_POLICY_NEXT_FIT */
 
-          /* CALCMAGIC() calculates the memory entry's magic value (i.e. the
-           * magic member of the memory entry structure) by XOR'ing the address
-           * of the memory entry with the MAGIC_CONST. The magic value is used
-           * by __MemoryRegionCheck__() to check the consistency of the memory
-           * region. */
-          cursor->magic = CALCMAGIC(cursor);
-          cursor->free = FREE;
-          cursor->blocks += merge->blocks;
-          cursor->next = merge->next;
 
+  /* Zero out the block formerly occupied by the memory entry that was merged.
+   * This has to be done before interrupts are re-enabled because the block is
+   * now part of a free entry that could be handed out. */
+  __memset__(merge, zero, sizeof(MemoryEntry_t));
 
-          /* Zero out the block formerly occupied by the memory entry that was
-           * merged. */
-          if(OK(__memset__(merge, zero, sizeof(MemoryEntry_t)))) {
-            /* Do nothing - literally. */
+  return;
+}
+
+
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+
+
+  Return_t __BuddyAllocateMemory__(volatile Addr_t **addr_, const Size_t size_) {
+    RET_DEFINE;
+
+    if(NOTNULLPTR(addr_) && (zero < size_)) {
+      /* Simply passthrough the address pointer to __BuddyCalloc__() for the
+       * buddy memory region and the size of the requested memory. */
+      if(OK(__BuddyCalloc__(&buddy, addr_, size_))) {
+        if(NOTNULLPTR(*addr_)) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+  Return_t __BuddyFreeMemory__(const volatile Addr_t *addr_) {
+    RET_DEFINE;
+
+    if(NOTNULLPTR(addr_)) {
+      /* Simply passthrough the address pointer to __BuddyFree__() for the buddy
+       * memory region. */
+      if(OK(__BuddyFree__(&buddy, addr_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+  Return_t __MemoryRegionCheckBuddy__(const volatile Addr_t *addr_, const Base_t option_) {
+    RET_DEFINE;
+
+    if((NULLPTR(addr_) && (MEMORY_REGION_CHECK_OPTION_WO_ADDR == option_)) || (NOTNULLPTR(addr_) && (MEMORY_REGION_CHECK_OPTION_W_ADDR == option_))) {
+      /* Simply passthrough the address pointer to __BuddyRegionCheck__() for
+       * the buddy memory region and the region check option. */
+      if(OK(__BuddyRegionCheck__(&buddy, addr_, option_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+  static Return_t __BuddyRegionCheck__(const volatile BuddyRegion_t *region_, const volatile Addr_t *addr_, const Base_t option_) {
+    RET_DEFINE;
+
+
+    HalfWord_t index = zero;
+    Base_t order = zero;
+    Word_t available = zero;
+
+
+    if(MEMORY_REGION_CHECK_OPTION_WO_ADDR == option_) {
+      /* Hop from one buddy block to the next using the order recorded for the
+       * first block of each. Every buddy block must be marked either free or
+       * in-use, must be aligned to its own size and must not run past the end
+       * of the buddy memory region. Free buddy blocks must also carry a valid
+       * magic value. */
+      while(BUDDY_REGION_SIZE_IN_BLOCKS > index) {
+        order = region_->blocks[index] & BUDDY_ORDER_MASK;
+
+        if(((BUDDY_FREE | order) != region_->blocks[index]) && ((BUDDY_INUSE | order) != region_->blocks[index])) {
+          break;
+        }
+
+        if((BUDDY_REGION_ORDERS <= order) || (zero != (index & ((0x1u << order) - 0x1u)))) {
+          break;
+        }
+
+        if(BUDDY_FREE & region_->blocks[index]) {
+          if(!OKMAGIC(INDEX2BUDDY(index, region_))) {
+            break;
+          }
+
+          available += BUDDY_BYTES(order);
+        }
+
+        index += (HalfWord_t) (0x1u << order);
+      }
+
+
+      /* If we landed exactly on the end of the buddy memory region and the free
+       * buddy blocks add up to what the buddy memory region thinks is available
+       * then the buddy memory region is consistent. */
+      if((BUDDY_REGION_SIZE_IN_BLOCKS == index) && (region_->available == available)) {
+        RET_OK;
+      } else {
+        ASSERT;
+        FLAG_MEMFAULT = true;
+      }
+    } else if(MEMORY_REGION_CHECK_OPTION_W_ADDR == option_) {
+      /* Unlike the heap and kernel memory regions, an address in the buddy
+       * memory region can be checked without traversing the region. The address
+       * must fall on a block boundary and that block must be the first block of
+       * an in-use buddy block. */
+      if(((const volatile Byte_t *) addr_ >= region_->base) && ((const volatile Byte_t *) addr_ < (region_->base + BUDDY_REGION_SIZE_IN_BYTES))) {
+        if(zero == ((((const volatile Byte_t *) addr_) - region_->base) % BUDDY_REGION_BLOCK_SIZE)) {
+          index = BUDDY2INDEX(addr_, region_);
+          order = region_->blocks[index] & BUDDY_ORDER_MASK;
+
+          if(((BUDDY_INUSE | order) == region_->blocks[index]) && (BUDDY_REGION_ORDERS > order) && (zero == (index & ((0x1u << order) - 0x1u)))) {
+            RET_OK;
           } else {
             ASSERT;
-            break;
           }
         } else {
-          cursor = cursor->next;
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      /* If we made it here, "option_" did not contain a valid argument. */
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+  static Return_t __BuddyCalloc__(volatile BuddyRegion_t *region_, volatile Addr_t **addr_, const Size_t size_) {
+    RET_DEFINE;
+    CRITICAL_DEFINE;
+
+
+    Base_t order = zero;
+    Base_t split = zero;
+    Base_t committed = false;
+    HalfWord_t index = zero;
+    BuddyEntry_t *entry = null;
+
+
+    if(NOTNULLPTR(region_) && NOTNULLPTR(addr_) && (zero < size_) && (BUDDY_REGION_SIZE_IN_BYTES >= size_)) {
+      /* Find the smallest order whose buddy block covers the request. */
+      while(BUDDY_BYTES(order) < size_) {
+        order++;
+      }
+
+
+      /* Because we are modifying the free lists, we need to disable interrupts
+       * until the buddy block has been taken off of them. */
+      ENTER_CRITICAL(CriticalSiteBuddyAlloc);
+
+
+      /* Find the smallest order, at or above the one needed, with a free buddy
+       * block to hand out or split. */
+      split = order;
+
+      while((BUDDY_REGION_ORDERS > split) && NULLPTR(region_->free[split])) {
+        split++;
+      }
+
+      if(BUDDY_REGION_ORDERS > split) {
+        entry = region_->free[split];
+
+        if(OKMAGIC(entry)) {
+          __BuddyUnlink__(region_, entry, split);
+          index = BUDDY2INDEX(entry, region_);
+
+
+          /* Split the buddy block in half until it is the order that was
+           * requested. The upper half of each split goes back on the free list
+           * one order down. */
+          while(split > order) {
+            split--;
+            region_->blocks[index + (0x1u << split)] = BUDDY_FREE | split;
+            __BuddyLink__(region_, (BuddyEntry_t *) ((Byte_t *) entry + BUDDY_BYTES(split)), split);
+          }
+
+          region_->blocks[index] = BUDDY_INUSE | order;
+          region_->allocations++;
+          region_->available -= BUDDY_BYTES(order);
+
+          if(region_->available < region_->minAvailableEver) {
+            region_->minAvailableEver = region_->available;
+          }
+
+          committed = true;
+        } else {
+          ASSERT;
+          FLAG_MEMFAULT = true;
         }
+      } else {
+        ASSERT;
       }
 
-      RET_OK;
+
+      /* The buddy block is off of the free lists so restore interrupts. */
+      EXIT_CRITICAL(CriticalSiteBuddyAlloc);
+
+      if(true == committed) {
+        /* Zero out the buddy block, including where the buddy entry used to
+         * be. The buddy block belongs to the caller now so this can be done
+         * with interrupts enabled. */
+        if(OK(__memset__(entry, zero, BUDDY_BYTES(order)))) {
+          *addr_ = (Addr_t *) entry;
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      }
     } else {
       ASSERT;
     }
-  } else {
-    ASSERT;
+
+    RET_RETURN;
   }
 
-  RET_RETURN;
-}
+
+  static Return_t __BuddyFree__(volatile BuddyRegion_t *region_, const volatile Addr_t *addr_) {
+    RET_DEFINE;
+    CRITICAL_DEFINE;
+
+
+    Base_t order = zero;
+    HalfWord_t index = zero;
+    HalfWord_t other = zero;
+    BuddyEntry_t *entry = null;
+
+
+    /* Because we are modifying the free lists, we need to disable interrupts
+     * until __BuddyFree__() is done. Checking the address and merging are both
+     * bounded by the number of orders so neither is worth moving out. */
+    ENTER_CRITICAL(CriticalSiteBuddyFree);
+
+    if(NOTNULLPTR(region_) && NOTNULLPTR(addr_)) {
+      /* Check the address pointer to ensure it is pointing to an in-use buddy
+       * block. */
+      if(OK(__BuddyRegionCheck__(region_, addr_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+        index = BUDDY2INDEX(addr_, region_);
+        order = region_->blocks[index] & BUDDY_ORDER_MASK;
+        region_->frees++;
+        region_->available += BUDDY_BYTES(order);
+
+
+        /* Merge the buddy block with its buddy for as long as the buddy is free
+         * and of the same order. The buddy of a buddy block is found by
+         * flipping the bit of its index that matches its order. */
+        while((BUDDY_REGION_ORDERS - 0x1u) > order) {
+          other = index ^ (HalfWord_t) (0x1u << order);
+
+          if((BUDDY_FREE | order) != region_->blocks[other]) {
+            break;
+          }
+
+          entry = INDEX2BUDDY(other, region_);
+
+          if(!OKMAGIC(entry)) {
+            ASSERT;
+            FLAG_MEMFAULT = true;
+            break;
+          }
+
+          __BuddyUnlink__(region_, entry, order);
+
+
+          /* Only the lower of the two buddies keeps its order, the upper one
+           * becomes part of the merged buddy block. */
+          if(other < index) {
+            region_->blocks[index] = zero;
+            index = other;
+          } else {
+            region_->blocks[other] = zero;
+          }
+
+          order++;
+        }
+
+        region_->blocks[index] = BUDDY_FREE | order;
+        __BuddyLink__(region_, INDEX2BUDDY(index, region_), order);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+
+    /* __BuddyFree__() is done so restore interrupts. */
+    EXIT_CRITICAL(CriticalSiteBuddyFree);
+    RET_RETURN;
+  }
+
+
+  static void __BuddyLink__(volatile BuddyRegion_t *region_, BuddyEntry_t *entry_, const Base_t order_) {
+    /* Push the buddy entry onto the front of the free list for its order. */
+    entry_->magic = CALCMAGIC(entry_);
+    entry_->prev = null;
+    entry_->next = region_->free[order_];
+
+    if(NOTNULLPTR(entry_->next)) {
+      entry_->next->prev = entry_;
+    }
+
+    region_->free[order_] = entry_;
+
+    return;
+  }
+
+
+  static void __BuddyUnlink__(volatile BuddyRegion_t *region_, BuddyEntry_t *entry_, const Base_t order_) {
+    /* Because the free lists are doubly linked, a buddy entry can be removed
+     * from anywhere in its free list without a traversal. */
+    if(NOTNULLPTR(entry_->prev)) {
+      entry_->prev->next = entry_->next;
+    } else {
+      region_->free[order_] = entry_->next;
+    }
+
+    if(NOTNULLPTR(entry_->next)) {
+      entry_->next->prev = entry_->prev;
+    }
+
+    entry_->magic = zero;
+    entry_->next = null;
+    entry_->prev = null;
+
+    return;
+  }
+
+
+  static Return_t __BuddyRegionInit__(volatile BuddyRegion_t *region_) {
+    RET_DEFINE;
+
+
+    Base_t order = zero;
+
+
+    if(NOTNULLPTR(region_)) {
+      /* The buddy memory region storage has room for the base to be rounded up
+       * to a multiple of BUDDY_REGION_ALIGNMENT. That way every buddy block is
+       * aligned to its own size, up to BUDDY_REGION_ALIGNMENT, in absolute
+       * terms and not just relative to the start of the region. */
+      region_->base = (Byte_t *) region_->mem + ((BUDDY_REGION_ALIGNMENT - ((Size_t) region_->mem % BUDDY_REGION_ALIGNMENT)) %
+        BUDDY_REGION_ALIGNMENT);
+      region_->allocations = zero;
+      region_->frees = zero;
+      region_->available = BUDDY_REGION_SIZE_IN_BYTES;
+      region_->minAvailableEver = BUDDY_REGION_SIZE_IN_BYTES;
+
+      for(order = zero; order < BUDDY_REGION_ORDERS; order++) {
+        region_->free[order] = null;
+      }
+
+
+      /* Clear the block orders and create one free buddy block that spans the
+       * entire buddy memory region. */
+      if(OK(__memset__(region_->blocks, zero, BUDDY_REGION_SIZE_IN_BLOCKS))) {
+        region_->blocks[0] = BUDDY_FREE | (BUDDY_REGION_ORDERS - 0x1u);
+        __BuddyLink__(region_, (BuddyEntry_t *) region_->base, BUDDY_REGION_ORDERS - 0x1u);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
 
 
 #if defined(POSIX_ARCH_OTHER)
@@ -1122,9 +2031,14 @@ static Return_t __DefragMemoryRegion__(const volatile MemoryRegion_t *region_) {
 
   /* For unit testing only! */
   void __MemoryClear__(void) {
+    statics = null;
     __MemoryRegionInit__(&heap);
     __MemoryRegionInit__(&kernel);
 
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+      __BuddyRegionInit__(&buddy);
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+
     return;
   }
 
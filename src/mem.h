@@ -38,15 +38,29 @@
   Return_t __KernelAllocateMemory__(volatile Addr_t **addr_, const Size_t size_);
   Return_t __KernelFreeMemory__(const volatile Addr_t *addr_);
   Return_t __MemoryRegionCheckKernel__(const volatile Addr_t *addr_, const Base_t option_);
+  Return_t __StaticAllocateMemory__(volatile Addr_t **addr_, Byte_t *storage_, const Size_t bytes_, const Size_t size_);
+  Return_t __KernelObjectFree__(const volatile Addr_t *addr_);
+  Return_t __KernelObjectCheck__(const volatile Addr_t *addr_);
   Return_t __HeapAllocateMemory__(volatile Addr_t **addr_, const Size_t size_);
   Return_t __HeapFreeMemory__(const volatile Addr_t *addr_);
   Return_t __MemoryRegionCheckHeap__(const volatile Addr_t *addr_, const Base_t option_);
+  Return_t __DeviceAllocateMemory__(volatile Addr_t **addr_, const Size_t size_);
+  Return_t __DeviceFreeMemory__(const volatile Addr_t *addr_);
+  Return_t __MemoryRegionCheckDevice__(const volatile Addr_t *addr_, const Base_t option_);
   Return_t __memcpy__(const volatile Addr_t *dest_, const volatile Addr_t *src_, const Size_t size_);
   Return_t __memset__(const volatile Addr_t *dest_, const Byte_t val_, const Size_t size_);
   Return_t __memcmp__(const volatile Addr_t *s1_, const volatile Addr_t *s2_, const Size_t size_, Base_t *res_);
   Return_t __MemoryInit__(void);
   Return_t xMemGetHeapStats(MemoryRegionStats_t **stats_);
   Return_t xMemGetKernelStats(MemoryRegionStats_t **stats_);
+  Return_t xMemGetRegionMap(const MemoryRegionId_t region_, MemoryRegionMapEntry_t *map_, const HalfWord_t size_, HalfWord_t *entries_);
+  Return_t xMemGetBuddyStats(MemoryRegionStats_t **stats_);
+
+  #if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+    Return_t __BuddyAllocateMemory__(volatile Addr_t **addr_, const Size_t size_);
+    Return_t __BuddyFreeMemory__(const volatile Addr_t *addr_);
+    Return_t __MemoryRegionCheckBuddy__(const volatile Addr_t *addr_, const Base_t option_);
+  #endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
 
   #if defined(POSIX_ARCH_OTHER)
     void __MemoryClear__(void);
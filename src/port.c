@@ -21,10 +21,24 @@
   static volatile Ticks_t sysTicks = zero;
 
 
+  #if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT
+    static Ticks_t cycles = zero;
+    static Word_t lastCycles = zero;
+  #endif /* if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT */
+
+
+  #if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS
+    static Ticks_t microseconds = zero;
+  #endif /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS */
+
+
   void SysTick_Handler(void) {
-    DISABLE_INTERRUPTS();
+    CRITICAL_DEFINE;
+
+
+    ENTER_CRITICAL(CriticalSitePortTick);
     sysTicks++;
-    ENABLE_INTERRUPTS();
+    EXIT_CRITICAL(CriticalSitePortTick);
 
     return;
   }
@@ -33,6 +47,57 @@
 #endif /* if defined(CMSIS_ARCH_CORTEXM) */
 
 
+#if defined(CONFIG_TASK_STACKFUL_ENABLE) && defined(POSIX_ARCH_OTHER)
+  static ucontext_t schedulerContext;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) && defined(POSIX_ARCH_OTHER) */
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE) && defined(POSIX_ARCH_OTHER)
+  static pthread_once_t kernelOnce = PTHREAD_ONCE_INIT;
+  static pthread_mutex_t kernelMutex;
+  static Word_t kernelDepth = zero;
+  static pthread_mutex_t criticalMutex;
+
+
+  /* Each thread has its own run queue. The thread that started the scheduler
+   * is thread zero and only the others are created by the executor. */
+  static pthread_t executorThreads[CONFIG_SCHEDULER_THREADS_MAXIMUM];
+  static Base_t executorIndex[CONFIG_SCHEDULER_THREADS_MAXIMUM];
+  static pthread_mutex_t executorQueueMutex[CONFIG_SCHEDULER_THREADS_MAXIMUM];
+  static volatile Addr_t *executorQueue[CONFIG_SCHEDULER_THREADS_MAXIMUM][EXECUTOR_QUEUE_SLOTS];
+  static HalfWord_t executorHead[CONFIG_SCHEDULER_THREADS_MAXIMUM];
+  static HalfWord_t executorLength[CONFIG_SCHEDULER_THREADS_MAXIMUM];
+  static pthread_mutex_t executorMutex = PTHREAD_MUTEX_INITIALIZER;
+  static pthread_cond_t executorWork = PTHREAD_COND_INITIALIZER;
+  static pthread_cond_t executorDone = PTHREAD_COND_INITIALIZER;
+  static Base_t executorThreadCount = zero;
+  static Base_t executorNext = zero;
+  static Base_t executorStopping = false;
+  static Word_t executorQueued = zero;
+  static Word_t executorPending = zero;
+  static Word_t executorRan = zero;
+  static void (*executorRun)(volatile Addr_t *item_) = null;
+
+
+  /* Each scheduler instance has its own thread. The thread that started the
+   * scheduler runs core zero and the others are created here. */
+  static pthread_key_t coreKey;
+  static pthread_t coreThreads[CONFIG_SCHEDULER_CORES];
+  static Base_t coreIndex[CONFIG_SCHEDULER_CORES];
+  static pthread_mutex_t coreMutex[CONFIG_SCHEDULER_CORES];
+  static pthread_cond_t coreWake[CONFIG_SCHEDULER_CORES];
+  static volatile Base_t coreBell[CONFIG_SCHEDULER_CORES];
+  static volatile Base_t coreSleeping[CONFIG_SCHEDULER_CORES];
+  static Base_t coreCount = zero;
+  static void (*coreRun)(const Base_t core_) = null;
+  static void __PortKernelInit__(void);
+  static void *__PortExecutorThread__(void *index_);
+  static volatile Addr_t *__PortExecutorTake__(const Base_t index_);
+  static void __PortExecutorRun__(volatile Addr_t *item_);
+  static void *__PortCoreThread__(void *index_);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) && defined(POSIX_ARCH_OTHER) */
+
+
 Ticks_t __PortGetSysTicks__(void) {
 
 
@@ -40,7 +105,13 @@ Ticks_t __PortGetSysTicks__(void) {
   defined(ARDUINO_TEENSY_MICROMOD) || defined(ARDUINO_TEENSY40) || defined(ARDUINO_TEENSY41) || defined(ARDUINO_TEENSY36) || defined(ARDUINO_TEENSY35) || \
   defined(ARDUINO_TEENSY31) || defined(ARDUINO_TEENSY32) || defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC)
 
-    return(millis());
+  #if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS
+      return((Ticks_t) micros());
+  #elif CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS
+      return((Ticks_t) micros() * 1000u);
+  #else  /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS */
+      return(millis());
+  #endif /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS */
 
 #elif defined(ARDUINO_ARCH_ESP32) || defined(ESP32)
 
@@ -48,17 +119,64 @@ Ticks_t __PortGetSysTicks__(void) {
 
 #elif defined(CMSIS_ARCH_CORTEXM)
 
-    return(sysTicks);
+  #if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT
+      Word_t now = zero;
+      Word_t primask = zero;
+      Ticks_t ticks = zero;
+
+
+      /* Widen the 32-bit DWT cycle counter to the width of Ticks_t. This holds
+       * as long as the ticks are read at least once before the cycle counter
+       * wraps around, which the scheduler does. The ticks may also be read from
+       * an interrupt so the widening is done with interrupts disabled. PRIMASK
+       * is restored rather than interrupts enabled so this is safe to call from
+       * within a critical section. */
+      primask = __get_PRIMASK();
+      DISABLE_INTERRUPTS();
+      now = (Word_t) DWT->CYCCNT;
+      cycles += (Ticks_t) ((Word_t) (now - lastCycles));
+      lastCycles = now;
+
+    #if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS
+
+        /* Only whole microseconds are taken out of the cycles so the rest are
+         * carried over to the next read. Dividing the widened cycle count
+         * instead would jump backward whenever it wrapped around. */
+        microseconds += cycles / SYSTEM_CORE_CLOCK_CYCLES_PER_MICROSECOND;
+        cycles %= SYSTEM_CORE_CLOCK_CYCLES_PER_MICROSECOND;
+        ticks = microseconds;
+    #else  /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS */
+        ticks = cycles;
+    #endif /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS */
+      __set_PRIMASK(primask);
+
+      return(ticks);
+  #else  /* if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT */
+      return(sysTicks);
+  #endif /* if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT */
 
 
 #elif defined(POSIX_ARCH_OTHER)
 
-    struct timeval t;
+  #if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT
+      struct timespec t;
+
 
+      clock_gettime(CLOCK_MONOTONIC, &t);
 
-    gettimeofday(&t, null);
+    #if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS
+        return(((Ticks_t) t.tv_sec * 1000000000u) + (Ticks_t) t.tv_nsec);
+    #else  /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS */
+        return(((Ticks_t) t.tv_sec * 1000000u) + ((Ticks_t) t.tv_nsec / 1000u));
+    #endif /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS */
+  #else  /* if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT */
+      struct timeval t;
 
-    return((t.tv_sec) * 1000 + (t.tv_usec) / 1000);
+
+      gettimeofday(&t, null);
+
+      return((t.tv_sec) * 1000 + (t.tv_usec) / 1000);
+  #endif /* if CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT */
 
 #endif /* if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAM) ||
         * defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_ESP8266) ||
@@ -86,6 +204,16 @@ Return_t __PortInit__(void) {
 #elif defined(CMSIS_ARCH_CORTEXM)
 
     SysTick_Config(SYSTEM_CORE_CLOCK_FREQUENCY / SYSTEM_CORE_CLOCK_PRESCALER);
+
+  #if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) || (CONFIG_TICK_RESOLUTION != TICK_RESOLUTION_DEFAULT)
+
+      /* Critical sections and, at the higher tick resolutions, the system
+       * ticks are counted in CPU cycles so start the DWT cycle counter. */
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CYCCNT = zero;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  #endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) || (CONFIG_TICK_RESOLUTION !=
+          * TICK_RESOLUTION_DEFAULT) */
     RET_OK;
 
 #elif defined(POSIX_ARCH_OTHER)
@@ -100,4 +228,825 @@ Return_t __PortInit__(void) {
         * defined(ARDUINO_TEENSY31) || defined(ARDUINO_TEENSY32) ||
         * defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC) */
   RET_RETURN;
-}
\ No newline at end of file
+}
+
+
+#if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+
+
+  Word_t __PortGetTimestamp__(void) {
+
+
+  #if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_STM32) || \
+    defined(ARDUINO_TEENSY_MICROMOD) || defined(ARDUINO_TEENSY40) || defined(ARDUINO_TEENSY41) || defined(ARDUINO_TEENSY36) || defined(ARDUINO_TEENSY35) || \
+    defined(ARDUINO_TEENSY31) || defined(ARDUINO_TEENSY32) || defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC)
+
+      return((Word_t) micros());
+
+  #elif defined(ARDUINO_ARCH_ESP32) || defined(ESP32)
+
+      return(0);
+
+  #elif defined(CMSIS_ARCH_CORTEXM)
+
+      return((Word_t) DWT->CYCCNT);
+
+  #elif defined(POSIX_ARCH_OTHER)
+
+      struct timespec t;
+
+
+      clock_gettime(CLOCK_MONOTONIC, &t);
+
+      return(((Word_t) t.tv_sec * 1000000000u) + (Word_t) t.tv_nsec);
+
+  #endif /* if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAM) ||
+          * defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_ESP8266) ||
+          * defined(ARDUINO_ARCH_STM32) || defined(ARDUINO_TEENSY_MICROMOD) ||
+          * defined(ARDUINO_TEENSY40) || defined(ARDUINO_TEENSY41) ||
+          * defined(ARDUINO_TEENSY36) || defined(ARDUINO_TEENSY35) ||
+          * defined(ARDUINO_TEENSY31) || defined(ARDUINO_TEENSY32) ||
+          * defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC) */
+  }
+
+
+#endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+
+
+#if defined(CONFIG_TICKLESS_IDLE_ENABLE)
+
+
+  void __PortIdle__(const Ticks_t ticks_) {
+
+
+  #if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAM) || defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_STM32) || \
+    defined(ARDUINO_TEENSY_MICROMOD) || defined(ARDUINO_TEENSY40) || defined(ARDUINO_TEENSY41) || defined(ARDUINO_TEENSY36) || defined(ARDUINO_TEENSY35) || \
+    defined(ARDUINO_TEENSY31) || defined(ARDUINO_TEENSY32) || defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC)
+
+      /* The Arduino cores do not offer a portable way to sleep so just return.
+       */
+
+  #elif defined(ARDUINO_ARCH_ESP32) || defined(ESP32)
+
+      /* See the note about ESP32 in port.h. */
+
+  #elif defined(CMSIS_ARCH_CORTEXM)
+
+    #if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_DEFAULT
+        Word_t reload = zero;
+        Word_t ticks = zero;
+        Word_t remaining = zero;
+        Word_t primask = zero;
+
+
+        /* A tick is a SysTick interrupt so, to sleep for more than one tick,
+         * SysTick is stopped and reloaded to fire when the last tick of the
+         * sleep would have. The SysTick reload value is only 24 bits wide so a
+         * long sleep is cut short. */
+        reload = SYSTEM_CORE_CLOCK_FREQUENCY / SYSTEM_CORE_CLOCK_PRESCALER;
+
+        if(((Ticks_t) (SysTick_LOAD_RELOAD_Msk / reload)) < ticks_) {
+          ticks = SysTick_LOAD_RELOAD_Msk / reload;
+        } else {
+          ticks = (Word_t) ticks_;
+        }
+
+        primask = __get_PRIMASK();
+        __disable_irq();
+
+
+        /* If the tick is already due, there is nothing to sleep through. */
+        if((0x1u < ticks) && (zero == (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))) {
+          SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+          remaining = SysTick->VAL;
+          SysTick->LOAD = remaining + ((ticks - 0x1u) * reload) - 0x1u;
+          SysTick->VAL = zero;
+          SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+
+          /* With interrupts disabled, WFI still wakes the processor when an
+           * interrupt is pending but the interrupt is not taken until PRIMASK
+           * is restored below, after SysTick has been put back. */
+          __DSB();
+          __WFI();
+          __ISB();
+          SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+          if(zero != (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk)) {
+            /* Slept for the whole time. The SysTick interrupt is pending and
+             * counts the last tick once interrupts are restored. */
+            sysTicks += (Ticks_t) (ticks - 0x1u);
+            SysTick->LOAD = reload - 0x1u;
+            SysTick->VAL = zero;
+            SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+          } else {
+            /* Woken early by another interrupt so count the ticks that went by
+             * and have SysTick fire when the tick in progress would have. */
+            remaining = SysTick->VAL;
+            sysTicks += (Ticks_t) ((ticks - 0x1u) - (remaining / reload));
+            remaining %= reload;
+
+            if(zero == remaining) {
+              remaining = reload;
+            }
+
+            SysTick->LOAD = remaining - 0x1u;
+            SysTick->VAL = zero;
+            SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+            SysTick->LOAD = reload - 0x1u;
+          }
+        } else {
+          __WFI();
+        }
+
+        __set_PRIMASK(primask);
+    #else  /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_DEFAULT */
+
+        /* At the higher tick resolutions the ticks come from the DWT cycle
+         * counter and SysTick keeps firing so wait for the next interrupt,
+         * which is at most one SysTick period away. */
+        __WFI();
+    #endif /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_DEFAULT */
+
+  #elif defined(POSIX_ARCH_OTHER)
+
+      struct timespec t;
+
+
+      /* If a signal arrives, perhaps to give a task a notification,
+       * clock_nanosleep() returns early which is what we want. */
+    #if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS
+        t.tv_sec = (time_t) (ticks_ / 1000000000u);
+        t.tv_nsec = (long) (ticks_ % 1000000000u);
+    #elif CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_MICROSECONDS
+        t.tv_sec = (time_t) (ticks_ / 1000000u);
+        t.tv_nsec = (long) (ticks_ % 1000000u) * 1000L;
+    #else  /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS */
+        t.tv_sec = (time_t) (ticks_ / 1000u);
+        t.tv_nsec = (long) (ticks_ % 1000u) * 1000000L;
+    #endif /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS */
+      clock_nanosleep(CLOCK_MONOTONIC, 0, &t, null);
+
+  #endif /* if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_SAM) ||
+          * defined(ARDUINO_ARCH_SAMD) || defined(ARDUINO_ARCH_ESP8266) ||
+          * defined(ARDUINO_ARCH_STM32) || defined(ARDUINO_TEENSY_MICROMOD) ||
+          * defined(ARDUINO_TEENSY40) || defined(ARDUINO_TEENSY41) ||
+          * defined(ARDUINO_TEENSY36) || defined(ARDUINO_TEENSY35) ||
+          * defined(ARDUINO_TEENSY31) || defined(ARDUINO_TEENSY32) ||
+          * defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC) */
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_TICKLESS_IDLE_ENABLE) */
+
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+
+  Return_t __PortContextCreate__(volatile Addr_t **context_, const Size_t bytes_, void (*entry_)(void)) {
+    RET_DEFINE;
+
+  #if defined(POSIX_ARCH_OTHER)
+
+      ucontext_t *context = null;
+
+
+      /* The context and the stack it runs on are allocated together with the
+       * stack right after the context. */
+      if(OK(__KernelAllocateMemory__(context_, sizeof(ucontext_t) + bytes_))) {
+        context = (ucontext_t *) *context_;
+
+        if(zero == getcontext(context)) {
+          context->uc_stack.ss_sp = (void *) (((Byte_t *) context) + sizeof(ucontext_t));
+          context->uc_stack.ss_size = bytes_;
+          context->uc_link = null;
+          makecontext(context, entry_, 0);
+          RET_OK;
+        } else {
+          ASSERT;
+          __KernelFreeMemory__(*context_);
+        }
+      } else {
+        ASSERT;
+      }
+
+  #else  /* if defined(POSIX_ARCH_OTHER) */
+
+      /* There is no portable way to switch stacks on the other architectures
+       * so stackful tasks are only supported on POSIX. */
+      ASSERT;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+    RET_RETURN;
+  }
+
+
+  void __PortContextEnter__(volatile Addr_t *context_) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      swapcontext(&schedulerContext, (ucontext_t *) context_);
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  void __PortContextLeave__(volatile Addr_t *context_) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      swapcontext((ucontext_t *) context_, &schedulerContext);
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+
+  Return_t __PortKernelLock__(void) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      pthread_once(&kernelOnce, __PortKernelInit__);
+      pthread_mutex_lock(&kernelMutex);
+      kernelDepth++;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return(ReturnError);
+  }
+
+
+  Return_t __PortKernelUnlock__(const Return_t ret_) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      kernelDepth--;
+      pthread_mutex_unlock(&kernelMutex);
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return(ret_);
+  }
+
+
+  /* Stands in for disabling interrupts on POSIX. Nothing is ever taken while
+   * the critical lock is held so it cannot deadlock with the kernel lock. */
+  Word_t __PortCriticalLock__(void) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      pthread_once(&kernelOnce, __PortKernelInit__);
+      pthread_mutex_lock(&criticalMutex);
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return(zero);
+  }
+
+
+  void __PortCriticalUnlock__(const Word_t state_) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      pthread_mutex_unlock(&criticalMutex);
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  /* Lets go of the kernel lock however many times the calling thread holds it
+   * so other threads can make syscalls while the caller runs a task or waits.
+   * What is returned is given back to __PortKernelReacquire__() afterward. */
+  Word_t __PortKernelRelease__(void) {
+    Word_t depth = zero;
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Word_t i = zero;
+
+
+      depth = kernelDepth;
+      kernelDepth = zero;
+
+      for(i = zero; i < depth; i++) {
+        pthread_mutex_unlock(&kernelMutex);
+      }
+
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return(depth);
+  }
+
+
+  void __PortKernelReacquire__(const Word_t depth_) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Word_t i = zero;
+
+
+      for(i = zero; i < depth_; i++) {
+        pthread_mutex_lock(&kernelMutex);
+      }
+
+      kernelDepth = depth_;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  Return_t __PortExecutorStart__(const Base_t threads_, void (*run_)(volatile Addr_t *item_)) {
+    RET_DEFINE;
+
+  #if defined(POSIX_ARCH_OTHER)
+
+      Base_t i = zero;
+
+
+      if((zero < threads_) && (CONFIG_SCHEDULER_THREADS_MAXIMUM >= threads_) && NOTNULLPTR(run_) && (zero == executorThreadCount)) {
+        executorRun = run_;
+        executorStopping = false;
+        executorNext = zero;
+        executorQueued = zero;
+        executorPending = zero;
+        executorRan = zero;
+
+        for(i = zero; i < threads_; i++) {
+          executorIndex[i] = i;
+          executorHead[i] = zero;
+          executorLength[i] = zero;
+          pthread_mutex_init(&executorQueueMutex[i], null);
+        }
+
+        executorThreadCount = threads_;
+
+        /* Thread zero is the thread that started the scheduler so it is
+         * already running. */
+        for(i = 1; i < threads_; i++) {
+          if(zero != pthread_create(&executorThreads[i], null, __PortExecutorThread__, &executorIndex[i])) {
+            break;
+          }
+        }
+
+        if(i == threads_) {
+          RET_OK;
+        } else {
+          ASSERT;
+
+
+          /* Only stop the threads that were created. */
+          executorThreadCount = i;
+          __PortExecutorStop__();
+        }
+      } else {
+        ASSERT;
+      }
+
+  #else  /* if defined(POSIX_ARCH_OTHER) */
+
+      /* Threads are only supported on POSIX. */
+      ASSERT;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+    RET_RETURN;
+  }
+
+
+  /* Puts the item on the next thread's run queue. Items are handed out to the
+   * threads in turn and any thread that runs out of work steals from the
+   * others. If the run queue is full, the caller should run the item itself.
+   */
+  Return_t __PortExecutorSubmit__(volatile Addr_t *item_) {
+    RET_DEFINE;
+
+  #if defined(POSIX_ARCH_OTHER)
+
+      Base_t index = zero;
+
+
+      if(NOTNULLPTR(item_) && (zero < executorThreadCount)) {
+        index = executorNext;
+        executorNext = (executorNext + 1) % executorThreadCount;
+        pthread_mutex_lock(&executorQueueMutex[index]);
+
+        if(EXECUTOR_QUEUE_SLOTS > executorLength[index]) {
+          /* Count the item before the run queue lock is let go of so no thread
+           * can take it before it is counted. */
+          pthread_mutex_lock(&executorMutex);
+          executorQueued++;
+          executorPending++;
+          pthread_cond_signal(&executorWork);
+          pthread_mutex_unlock(&executorMutex);
+          executorQueue[index][(executorHead[index] + executorLength[index]) % EXECUTOR_QUEUE_SLOTS] = item_;
+          executorLength[index]++;
+          RET_OK;
+        }
+
+        pthread_mutex_unlock(&executorQueueMutex[index]);
+      } else {
+        ASSERT;
+      }
+
+  #else  /* if defined(POSIX_ARCH_OTHER) */
+      ASSERT;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+    RET_RETURN;
+  }
+
+
+  /* Called by thread zero to run items alongside the other threads until every
+   * item submitted so far has been run. The kernel lock is let go of while
+   * waiting so the items can make syscalls. Returns how many items were run.
+   */
+  Word_t __PortExecutorWait__(void) {
+    Word_t ran = zero;
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Word_t depth = zero;
+      volatile Addr_t *item = null;
+
+
+      depth = __PortKernelRelease__();
+
+      for(;;) {
+        item = __PortExecutorTake__(zero);
+
+        if(NOTNULLPTR(item)) {
+          __PortExecutorRun__(item);
+        } else {
+          pthread_mutex_lock(&executorMutex);
+
+          if(zero == executorPending) {
+            pthread_mutex_unlock(&executorMutex);
+            break;
+          }
+
+          /* Nothing is left to steal so wait for the other threads to finish
+           * what they are running. */
+          if(zero == executorQueued) {
+            pthread_cond_wait(&executorDone, &executorMutex);
+          }
+
+          pthread_mutex_unlock(&executorMutex);
+        }
+      }
+
+      pthread_mutex_lock(&executorMutex);
+      ran = executorRan;
+      executorRan = zero;
+      pthread_mutex_unlock(&executorMutex);
+      __PortKernelReacquire__(depth);
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return(ran);
+  }
+
+
+  void __PortExecutorStop__(void) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Base_t i = zero;
+
+
+      pthread_mutex_lock(&executorMutex);
+      executorStopping = true;
+      pthread_cond_broadcast(&executorWork);
+      pthread_mutex_unlock(&executorMutex);
+
+      for(i = 1; i < executorThreadCount; i++) {
+        pthread_join(executorThreads[i], null);
+      }
+
+      for(i = zero; i < executorThreadCount; i++) {
+        pthread_mutex_destroy(&executorQueueMutex[i]);
+      }
+
+      executorThreadCount = zero;
+      executorRun = null;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  /* Creates a thread for each scheduler instance but the first, which is run
+   * by the caller. If not every thread could be created, the caller has to
+   * stop the scheduler instances that were started and then call
+   * __PortCoreStop__(). */
+  Return_t __PortCoreStart__(const Base_t cores_, void (*run_)(const Base_t core_)) {
+    RET_DEFINE;
+
+  #if defined(POSIX_ARCH_OTHER)
+
+      Base_t i = zero;
+      pthread_condattr_t attr;
+
+
+      if((zero < cores_) && (CONFIG_SCHEDULER_CORES >= cores_) && NOTNULLPTR(run_) && (zero == coreCount)) {
+        pthread_once(&kernelOnce, __PortKernelInit__);
+        coreRun = run_;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+
+        for(i = zero; i < cores_; i++) {
+          coreIndex[i] = i;
+          coreBell[i] = zero;
+          coreSleeping[i] = zero;
+          pthread_mutex_init(&coreMutex[i], null);
+          pthread_cond_init(&coreWake[i], &attr);
+        }
+
+        pthread_condattr_destroy(&attr);
+        coreCount = cores_;
+
+        for(i = 1; i < cores_; i++) {
+          if(zero != pthread_create(&coreThreads[i], null, __PortCoreThread__, &coreIndex[i])) {
+            break;
+          }
+        }
+
+        if(i == cores_) {
+          RET_OK;
+        } else {
+          ASSERT;
+          coreCount = i;
+        }
+      } else {
+        ASSERT;
+      }
+
+  #else  /* if defined(POSIX_ARCH_OTHER) */
+
+      /* Scheduler instances are only run on their own threads on POSIX. */
+      ASSERT;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+    RET_RETURN;
+  }
+
+
+  /* Waits for the scheduler instance threads to return. The kernel lock is let
+   * go of while waiting so they can finish their passes. */
+  void __PortCoreStop__(void) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Base_t i = zero;
+      Word_t depth = zero;
+
+
+      depth = __PortKernelRelease__();
+
+      for(i = 1; i < coreCount; i++) {
+        pthread_join(coreThreads[i], null);
+      }
+
+      __PortKernelReacquire__(depth);
+
+      for(i = zero; i < coreCount; i++) {
+        pthread_cond_destroy(&coreWake[i]);
+        pthread_mutex_destroy(&coreMutex[i]);
+      }
+
+      coreCount = zero;
+      coreRun = null;
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  /* Returns the scheduler instance run by the calling thread. Any thread not
+   * created by __PortCoreStart__() counts as core zero. */
+  Base_t __PortCoreGet__(void) {
+    Base_t core = zero;
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Base_t *index = null;
+
+
+      pthread_once(&kernelOnce, __PortKernelInit__);
+      index = (Base_t *) pthread_getspecific(coreKey);
+
+      if(NOTNULLPTR(index)) {
+        core = *index;
+      }
+
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return(core);
+  }
+
+
+  /* Rings a scheduler instance's bell so it looks at its lists again. Ringing
+   * is an atomic operation and the core's mutex is only taken to wake it if it
+   * is actually waiting, so the notifier never waits on the notified core.
+   * __PortCoreWait__() says it is waiting before it checks the bell and this
+   * rings the bell before it checks whether the core is waiting, so at least
+   * one of them sees the other. */
+  void __PortCoreNotify__(const Base_t core_) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+
+      if((core_ < coreCount) && (zero == __sync_fetch_and_or(&coreBell[core_], 0x1u))) {
+        if(zero != __sync_fetch_and_or(&coreSleeping[core_], zero)) {
+          pthread_mutex_lock(&coreMutex[core_]);
+          pthread_cond_signal(&coreWake[core_]);
+          pthread_mutex_unlock(&coreMutex[core_]);
+        }
+      }
+
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  /* Called by an idle scheduler instance to wait, without the kernel lock,
+   * until another core rings its bell or CORE_WAIT_NANOSECONDS pass so task
+   * timers are still looked at. */
+  void __PortCoreWait__(const Base_t core_) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Word_t depth = zero;
+      struct timespec t;
+
+
+      if(core_ < coreCount) {
+        depth = __PortKernelRelease__();
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        t.tv_nsec += (long) CORE_WAIT_NANOSECONDS;
+
+        if(1000000000L <= t.tv_nsec) {
+          t.tv_sec++;
+          t.tv_nsec -= 1000000000L;
+        }
+
+        pthread_mutex_lock(&coreMutex[core_]);
+        __sync_fetch_and_or(&coreSleeping[core_], 0x1u);
+
+        if(zero == __sync_fetch_and_and(&coreBell[core_], zero)) {
+          pthread_cond_timedwait(&coreWake[core_], &coreMutex[core_], &t);
+        }
+
+        __sync_fetch_and_and(&coreSleeping[core_], zero);
+        __sync_fetch_and_and(&coreBell[core_], zero);
+        pthread_mutex_unlock(&coreMutex[core_]);
+        __PortKernelReacquire__(depth);
+      }
+
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  /* Lets the other scheduler instances have the kernel lock between passes.
+   */
+  void __PortCoreYield__(void) {
+
+
+  #if defined(POSIX_ARCH_OTHER)
+      Word_t depth = zero;
+
+
+      depth = __PortKernelRelease__();
+      sched_yield();
+      __PortKernelReacquire__(depth);
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+    return;
+  }
+
+
+  #if defined(POSIX_ARCH_OTHER)
+
+
+    static void __PortKernelInit__(void) {
+      pthread_mutexattr_t attr;
+
+
+      /* A syscall may make other syscalls so the kernel lock must be
+       * recursive. */
+      pthread_mutexattr_init(&attr);
+      pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+      pthread_mutex_init(&kernelMutex, &attr);
+      pthread_mutex_init(&criticalMutex, &attr);
+      pthread_mutexattr_destroy(&attr);
+      pthread_key_create(&coreKey, null);
+
+      return;
+    }
+
+
+    static void *__PortExecutorThread__(void *index_) {
+      Base_t index = zero;
+      volatile Addr_t *item = null;
+
+
+      index = *((Base_t *) index_);
+
+      for(;;) {
+        item = __PortExecutorTake__(index);
+
+        if(NOTNULLPTR(item)) {
+          __PortExecutorRun__(item);
+        } else {
+          pthread_mutex_lock(&executorMutex);
+
+          while((false == executorStopping) && (zero == executorQueued)) {
+            pthread_cond_wait(&executorWork, &executorMutex);
+          }
+
+          if(true == executorStopping) {
+            pthread_mutex_unlock(&executorMutex);
+            break;
+          }
+
+          pthread_mutex_unlock(&executorMutex);
+        }
+      }
+
+      return(null);
+    }
+
+
+    /* A thread takes the item it was given most recently from its own run
+     * queue, while it is still warm in the cache, and steals the oldest item
+     * from another thread's run queue when its own is empty. */
+    static volatile Addr_t *__PortExecutorTake__(const Base_t index_) {
+      Base_t i = zero;
+      Base_t victim = zero;
+      volatile Addr_t *item = null;
+
+
+      pthread_mutex_lock(&executorQueueMutex[index_]);
+
+      if(zero < executorLength[index_]) {
+        executorLength[index_]--;
+        item = executorQueue[index_][(executorHead[index_] + executorLength[index_]) % EXECUTOR_QUEUE_SLOTS];
+      }
+
+      pthread_mutex_unlock(&executorQueueMutex[index_]);
+
+      for(i = 1; (NULLPTR(item)) && (i < executorThreadCount); i++) {
+        victim = (index_ + i) % executorThreadCount;
+        pthread_mutex_lock(&executorQueueMutex[victim]);
+
+        if(zero < executorLength[victim]) {
+          item = executorQueue[victim][executorHead[victim]];
+          executorHead[victim] = (executorHead[victim] + 1) % EXECUTOR_QUEUE_SLOTS;
+          executorLength[victim]--;
+        }
+
+        pthread_mutex_unlock(&executorQueueMutex[victim]);
+      }
+
+      if(NOTNULLPTR(item)) {
+        pthread_mutex_lock(&executorMutex);
+        executorQueued--;
+        pthread_mutex_unlock(&executorMutex);
+      }
+
+      return(item);
+    }
+
+
+    static void __PortExecutorRun__(volatile Addr_t *item_) {
+      (*executorRun)(item_);
+      pthread_mutex_lock(&executorMutex);
+      executorPending--;
+      executorRan++;
+
+      if(zero == executorPending) {
+        pthread_cond_broadcast(&executorDone);
+      }
+
+      pthread_mutex_unlock(&executorMutex);
+
+      return;
+    }
+
+
+    static void *__PortCoreThread__(void *index_) {
+      pthread_setspecific(coreKey, index_);
+      (*coreRun)(*((Base_t *) index_));
+
+      return(null);
+    }
+
+
+  #endif /* if defined(POSIX_ARCH_OTHER) */
+
+
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
@@ -39,6 +39,24 @@
 
     #define ENABLE_INTERRUPTS() interrupts()
 
+    #if defined(ARDUINO_ARCH_AVR)
+      #define SAVE_AND_DISABLE_INTERRUPTS(state_) \
+              (state_) = (Word_t) SREG; \
+              noInterrupts()
+
+      #define RESTORE_INTERRUPTS(state_) SREG = (uint8_t) (state_)
+    #elif defined(ARDUINO_ARCH_ESP8266)
+      #define SAVE_AND_DISABLE_INTERRUPTS(state_) (state_) = (Word_t) xt_rsil(15)
+
+      #define RESTORE_INTERRUPTS(state_) xt_wsr_ps((uint32_t) (state_))
+    #else  /* if defined(ARDUINO_ARCH_AVR) */
+      #define SAVE_AND_DISABLE_INTERRUPTS(state_) \
+              __asm__ volatile ("mrs %0, primask" : "=r" (state_)); \
+              noInterrupts()
+
+      #define RESTORE_INTERRUPTS(state_) __asm__ volatile ("msr primask, %0" : : "r" (state_) : "memory")
+    #endif /* if defined(ARDUINO_ARCH_AVR) */
+
   #elif defined(ARDUINO_ARCH_ESP32) || defined(ESP32)
 
     #pragma message("WARNING: The ESP32 Arduino core uses FreeRTOS. HeliOS and FreeRTOS cannot coexist in the same application.")
@@ -47,6 +65,10 @@
 
     #define ENABLE_INTERRUPTS()
 
+    #define SAVE_AND_DISABLE_INTERRUPTS(state_) (state_) = zero
+
+    #define RESTORE_INTERRUPTS(state_) (void) (state_)
+
   #elif defined(CMSIS_ARCH_CORTEXM)
 
     #include "stm32f429xx.h"
@@ -55,20 +77,56 @@
 
     #define ENABLE_INTERRUPTS() __enable_irq()
 
+    #define SAVE_AND_DISABLE_INTERRUPTS(state_) \
+            (state_) = (Word_t) __get_PRIMASK(); \
+            __disable_irq()
+
+    #define RESTORE_INTERRUPTS(state_) __set_PRIMASK((uint32_t) (state_))
+
     #define SYSTEM_CORE_CLOCK_FREQUENCY 0xF42400u /* 16000000u */
 
     #define SYSTEM_CORE_CLOCK_PRESCALER 0x3E8u /* 1000u */
 
+    #define SYSTEM_CORE_CLOCK_CYCLES_PER_MICROSECOND (SYSTEM_CORE_CLOCK_FREQUENCY / 0xF4240u /* 1000000u */)
+
+    #if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS
+      #error "TICK_RESOLUTION_NANOSECONDS is not supported on ARM Cortex-M, use TICK_RESOLUTION_CYCLES to count CPU cycles."
+    #endif /* if CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_NANOSECONDS */
+
   #elif defined(POSIX_ARCH_OTHER)
 
     #include "posix.h"
 
     #include <stdio.h>
     #include <sys/time.h>
+    #include <time.h>
+
+    #if defined(CONFIG_TASK_STACKFUL_ENABLE)
+      #include <ucontext.h>
+    #endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+    #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      #include <pthread.h>
+      #include <sched.h>
+    #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
 
     #define DISABLE_INTERRUPTS()
 
     #define ENABLE_INTERRUPTS()
+
+    /* There are no interrupts on POSIX. However, with more than one thread, a
+     * FromISR() syscall may be made from a thread that does not hold the
+     * kernel lock so the critical sections are serialized by a lock of their
+     * own instead. */
+    #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      #define SAVE_AND_DISABLE_INTERRUPTS(state_) (state_) = __PortCriticalLock__()
+
+      #define RESTORE_INTERRUPTS(state_) __PortCriticalUnlock__(state_)
+    #else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+      #define SAVE_AND_DISABLE_INTERRUPTS(state_) (state_) = zero
+
+      #define RESTORE_INTERRUPTS(state_) (void) (state_)
+    #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
     #if defined(UNIT_TEST_COLORIZE)
       #define CONFIG_SYSTEM_ASSERT_BEHAVIOR(f, l) printf("\033[95mkernel:\033[93m assert at %s:%d\n\033[39m", f, l)
     #else  /* if defined(UNIT_TEST_COLORIZE) */
@@ -84,12 +142,78 @@
           * defined(ARDUINO_TEENSY30) || defined(ARDUINO_TEENSYLC) */
 
 
+  #if (CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_CYCLES) && !defined(CMSIS_ARCH_CORTEXM)
+    #error "TICK_RESOLUTION_CYCLES is only supported on ARM Cortex-M."
+  #endif /* if (CONFIG_TICK_RESOLUTION == TICK_RESOLUTION_CYCLES) && !defined(CMSIS_ARCH_CORTEXM) */
+
+
+  /* ENTER_CRITICAL() and EXIT_CRITICAL() disable interrupts for the critical
+   * sections in the kernel and then put them back the way they were, rather
+   * than enabling them, so a critical section may be entered from an
+   * interrupt or from within another critical section. The state is kept in
+   * the locals declared by CRITICAL_DEFINE. When
+   * CONFIG_CRITICAL_SECTION_STATS_ENABLE is defined, they also time how long
+   * interrupts were disabled and record it against the critical site. */
+  #if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+    #define CRITICAL_DEFINE \
+            Word_t criticalState = zero; \
+            Word_t criticalStart = zero
+
+    #define ENTER_CRITICAL(site_) \
+            SAVE_AND_DISABLE_INTERRUPTS(criticalState); \
+            criticalStart = __CriticalSectionEnter__()
+
+    #define EXIT_CRITICAL(site_) \
+            __CriticalSectionExit__(site_, criticalStart); \
+            RESTORE_INTERRUPTS(criticalState)
+  #else  /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+    #define CRITICAL_DEFINE Word_t criticalState = zero
+
+    #define ENTER_CRITICAL(site_) SAVE_AND_DISABLE_INTERRUPTS(criticalState)
+
+    #define EXIT_CRITICAL(site_) RESTORE_INTERRUPTS(criticalState)
+  #endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+
+
   #ifdef __cplusplus
     extern "C" {
   #endif /* ifdef __cplusplus */
   Ticks_t __PortGetSysTicks__(void);
   Return_t __PortInit__(void);
 
+  #if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+    Word_t __PortGetTimestamp__(void);
+  #endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+
+  #if defined(CONFIG_TICKLESS_IDLE_ENABLE)
+    void __PortIdle__(const Ticks_t ticks_);
+  #endif /* if defined(CONFIG_TICKLESS_IDLE_ENABLE) */
+
+  #if defined(CONFIG_TASK_STACKFUL_ENABLE)
+    Return_t __PortContextCreate__(volatile Addr_t **context_, const Size_t bytes_, void (*entry_)(void));
+    void __PortContextEnter__(volatile Addr_t *context_);
+    void __PortContextLeave__(volatile Addr_t *context_);
+  #endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+  #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    Return_t __PortKernelLock__(void);
+    Word_t __PortCriticalLock__(void);
+    void __PortCriticalUnlock__(const Word_t state_);
+    Return_t __PortKernelUnlock__(const Return_t ret_);
+    Word_t __PortKernelRelease__(void);
+    void __PortKernelReacquire__(const Word_t depth_);
+    Return_t __PortExecutorStart__(const Base_t threads_, void (*run_)(volatile Addr_t *item_));
+    Return_t __PortExecutorSubmit__(volatile Addr_t *item_);
+    Word_t __PortExecutorWait__(void);
+    void __PortExecutorStop__(void);
+    Return_t __PortCoreStart__(const Base_t cores_, void (*run_)(const Base_t core_));
+    void __PortCoreStop__(void);
+    Base_t __PortCoreGet__(void);
+    void __PortCoreNotify__(const Base_t core_);
+    void __PortCoreWait__(const Base_t core_);
+    void __PortCoreYield__(void);
+  #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
   #ifdef __cplusplus
     }
   #endif /* ifdef __cplusplus */
@@ -20,7 +20,7 @@ static Return_t __QueuePeek__(const Queue_t *queue_, QueueMessage_t **message_);
 
 
 Return_t xQueueCreate(Queue_t **queue_, Base_t limit_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(queue_) && (CONFIG_QUEUE_MINIMUM_LIMIT <= limit_)) {
     if(OK(__KernelAllocateMemory__((volatile Addr_t **) queue_, sizeof(Queue_t)))) {
@@ -41,14 +41,40 @@ Return_t xQueueCreate(Queue_t **queue_, Base_t limit_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
+}
+
+
+Return_t xQueueCreateStatic(Queue_t **queue_, Byte_t *storage_, const Size_t bytes_, const Base_t limit_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(queue_) && (CONFIG_QUEUE_MINIMUM_LIMIT <= limit_)) {
+    if(OK(__StaticAllocateMemory__((volatile Addr_t **) queue_, storage_, bytes_, sizeof(Queue_t)))) {
+      if(NOTNULLPTR(*queue_)) {
+        (*queue_)->length = zero;
+        (*queue_)->limit = limit_;
+        (*queue_)->locked = false;
+        (*queue_)->head = null;
+        (*queue_)->tail = null;
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueDelete(Queue_t *queue_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
-  if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+  if(OK(__KernelObjectCheck__(queue_))) {
     /* Loop through the queue while it contains messages and drop each message
      * until there are no more messages. */
     while(NOTNULLPTR(queue_->head)) {
@@ -60,7 +86,11 @@ Return_t xQueueDelete(Queue_t *queue_) {
       }
     }
 
-    if(OK(__KernelFreeMemory__(queue_))) {
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+      __TaskAwaitDrop__(queue_);
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+    if(OK(__KernelObjectFree__(queue_))) {
       RET_OK;
     } else {
       ASSERT;
@@ -69,12 +99,12 @@ Return_t xQueueDelete(Queue_t *queue_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueGetLength(const Queue_t *queue_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Base_t messages = zero;
@@ -82,7 +112,7 @@ Return_t xQueueGetLength(const Queue_t *queue_, Base_t *res_) {
 
 
   if(NOTNULLPTR(queue_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       cursor = queue_->head;
 
       while(NOTNULLPTR(cursor)) {
@@ -107,12 +137,12 @@ Return_t xQueueGetLength(const Queue_t *queue_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueIsQueueEmpty(const Queue_t *queue_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Base_t messages = zero;
@@ -120,7 +150,7 @@ Return_t xQueueIsQueueEmpty(const Queue_t *queue_, Base_t *res_) {
 
 
   if(NOTNULLPTR(queue_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       cursor = queue_->head;
 
       while(NOTNULLPTR(cursor)) {
@@ -151,12 +181,12 @@ Return_t xQueueIsQueueEmpty(const Queue_t *queue_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueIsQueueFull(const Queue_t *queue_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Base_t messages = zero;
@@ -164,7 +194,7 @@ Return_t xQueueIsQueueFull(const Queue_t *queue_, Base_t *res_) {
 
 
   if(NOTNULLPTR(queue_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       cursor = queue_->head;
 
       while(NOTNULLPTR(cursor)) {
@@ -196,12 +226,12 @@ Return_t xQueueIsQueueFull(const Queue_t *queue_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueMessagesWaiting(const Queue_t *queue_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Base_t messages = zero;
@@ -209,7 +239,7 @@ Return_t xQueueMessagesWaiting(const Queue_t *queue_, Base_t *res_) {
 
 
   if(NOTNULLPTR(queue_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       cursor = queue_->head;
 
       while(NOTNULLPTR(cursor)) {
@@ -241,12 +271,12 @@ Return_t xQueueMessagesWaiting(const Queue_t *queue_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueSend(Queue_t *queue_, const Base_t bytes_, const Byte_t *value_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Message_t *message = null;
@@ -255,7 +285,7 @@ Return_t xQueueSend(Queue_t *queue_, const Base_t bytes_, const Byte_t *value_)
 
 
   if(NOTNULLPTR(queue_) && (zero < bytes_) && (CONFIG_MESSAGE_VALUE_BYTES >= bytes_) && (NOTNULLPTR(value_))) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       if(false == queue_->locked) {
         cursor = queue_->head;
 
@@ -284,6 +314,9 @@ Return_t xQueueSend(Queue_t *queue_, const Base_t bytes_, const Byte_t *value_)
                 }
 
                 queue_->length++;
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+                  __TaskAwaitWake__(queue_, queue_->length);
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
                 RET_OK;
               } else {
                 ASSERT;
@@ -311,12 +344,12 @@ Return_t xQueueSend(Queue_t *queue_, const Base_t bytes_, const Byte_t *value_)
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueuePeek(const Queue_t *queue_, QueueMessage_t **message_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(queue_) && NOTNULLPTR(message_)) {
     if(OK(__QueuePeek__(queue_, message_))) {
@@ -328,7 +361,7 @@ Return_t xQueuePeek(const Queue_t *queue_, QueueMessage_t **message_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
@@ -336,7 +369,7 @@ static Return_t __QueuePeek__(const Queue_t *queue_, QueueMessage_t **message_)
   RET_DEFINE;
 
   if(NOTNULLPTR(queue_) && NOTNULLPTR(message_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       if(NOTNULLPTR(queue_->head)) {
         if(OK(__HeapAllocateMemory__((volatile Addr_t **) message_, sizeof(QueueMessage_t)))) {
           if(NOTNULLPTR(*message_)) {
@@ -372,7 +405,7 @@ static Return_t __QueuePeek__(const Queue_t *queue_, QueueMessage_t **message_)
 
 
 Return_t xQueueDropMessage(Queue_t *queue_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(queue_)) {
     if(OK(__QueueDropmessage__(queue_))) {
@@ -384,7 +417,7 @@ Return_t xQueueDropMessage(Queue_t *queue_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
@@ -396,7 +429,7 @@ static Return_t __QueueDropmessage__(Queue_t *queue_) {
 
 
   if(NOTNULLPTR(queue_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       if(NOTNULLPTR(queue_->head)) {
         message = queue_->head;
         queue_->head = queue_->head->next;
@@ -426,10 +459,10 @@ static Return_t __QueueDropmessage__(Queue_t *queue_) {
 
 
 Return_t xQueueReceive(Queue_t *queue_, QueueMessage_t **message_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(queue_) && NOTNULLPTR(message_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       if(OK(__QueuePeek__(queue_, message_))) {
         if(NOTNULLPTR(*message_)) {
           if(OK(__QueueDropmessage__(queue_))) {
@@ -450,15 +483,47 @@ Return_t xQueueReceive(Queue_t *queue_, QueueMessage_t **message_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
+}
+
+
+Return_t xQueueReceiveBlocking(Queue_t *queue_, QueueMessage_t **message_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+    if(NOTNULLPTR(queue_) && NOTNULLPTR(message_)) {
+      if(OK(__KernelObjectCheck__(queue_))) {
+        /* Only the stackful task that is running can block, so this fails for
+         * anything else. */
+        if(OK(__TaskBlock__(queue_, zero))) {
+          if(OK(xQueueReceive(queue_, message_))) {
+            RET_OK;
+          } else {
+            ASSERT;
+          }
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueLockQueue(Queue_t *queue_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(queue_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       if(false == queue_->locked) {
         queue_->locked = true;
         RET_OK;
@@ -472,15 +537,15 @@ Return_t xQueueLockQueue(Queue_t *queue_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xQueueUnLockQueue(Queue_t *queue_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(queue_)) {
-    if(OK(__MemoryRegionCheckKernel__(queue_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(queue_))) {
       if(true == queue_->locked) {
         queue_->locked = false;
         RET_OK;
@@ -494,5 +559,5 @@ Return_t xQueueUnLockQueue(Queue_t *queue_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
\ No newline at end of file
@@ -32,6 +32,7 @@
     extern "C" {
   #endif /* ifdef __cplusplus */
   Return_t xQueueCreate(Queue_t **queue_, const Base_t limit_);
+  Return_t xQueueCreateStatic(Queue_t **queue_, Byte_t *storage_, const Size_t bytes_, const Base_t limit_);
   Return_t xQueueDelete(Queue_t *queue_);
   Return_t xQueueGetLength(const Queue_t *queue_, Base_t *res_);
   Return_t xQueueIsQueueEmpty(const Queue_t *queue_, Base_t *res_);
@@ -41,6 +42,7 @@
   Return_t xQueuePeek(const Queue_t *queue_, QueueMessage_t **message_);
   Return_t xQueueDropMessage(Queue_t *queue_);
   Return_t xQueueReceive(Queue_t *queue_, QueueMessage_t **message_);
+  Return_t xQueueReceiveBlocking(Queue_t *queue_, QueueMessage_t **message_);
   Return_t xQueueLockQueue(Queue_t *queue_);
   Return_t xQueueUnLockQueue(Queue_t *queue_);
 
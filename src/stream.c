@@ -18,7 +18,7 @@
 
 
 Return_t xStreamCreate(StreamBuffer_t **stream_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_)) {
     if(OK(__KernelAllocateMemory__((volatile Addr_t **) stream_, sizeof(StreamBuffer_t)))) {
@@ -35,16 +35,42 @@ Return_t xStreamCreate(StreamBuffer_t **stream_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
+}
+
+
+Return_t xStreamCreateStatic(StreamBuffer_t **stream_, Byte_t *storage_, const Size_t bytes_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(stream_)) {
+    if(OK(__StaticAllocateMemory__((volatile Addr_t **) stream_, storage_, bytes_, sizeof(StreamBuffer_t)))) {
+      if(NOTNULLPTR(*stream_)) {
+        (*stream_)->length = zero;
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
 }
 
 
 Return_t xStreamDelete(const StreamBuffer_t *stream_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_)) {
-    if(OK(__MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
-      if(OK(__KernelFreeMemory__(stream_))) {
+    if(OK(__KernelObjectCheck__(stream_))) {
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+        __TaskAwaitDrop__(stream_);
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+      if(OK(__KernelObjectFree__(stream_))) {
         RET_OK;
       } else {
         ASSERT;
@@ -56,18 +82,21 @@ Return_t xStreamDelete(const StreamBuffer_t *stream_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xStreamSend(StreamBuffer_t *stream_, const Byte_t byte_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_)) {
-    if(OK(__MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(stream_))) {
       if(CONFIG_STREAM_BUFFER_BYTES > stream_->length) {
         stream_->buffer[stream_->length] = byte_;
         stream_->length++;
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+          __TaskAwaitWake__(stream_, stream_->length);
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
         RET_OK;
       } else {
         ASSERT;
@@ -79,15 +108,15 @@ Return_t xStreamSend(StreamBuffer_t *stream_, const Byte_t byte_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xStreamReceive(const StreamBuffer_t *stream_, HalfWord_t *bytes_, Byte_t **data_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_) && NOTNULLPTR(bytes_) && NOTNULLPTR(data_)) {
-    if(OK(__MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(stream_))) {
       if(zero < stream_->length) {
         if(OK(__HeapAllocateMemory__((volatile Addr_t **) data_, stream_->length * sizeof(Byte_t)))) {
           if(NOTNULLPTR(*data_)) {
@@ -126,15 +155,15 @@ Return_t xStreamReceive(const StreamBuffer_t *stream_, HalfWord_t *bytes_, Byte_
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xStreamBytesAvailable(const StreamBuffer_t *stream_, HalfWord_t *bytes_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_) && NOTNULLPTR(bytes_)) {
-    if(OK(__MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(stream_))) {
       if(zero < stream_->length) {
         *bytes_ = stream_->length;
         RET_OK;
@@ -148,15 +177,15 @@ Return_t xStreamBytesAvailable(const StreamBuffer_t *stream_, HalfWord_t *bytes_
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xStreamReset(const StreamBuffer_t *stream_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_)) {
-    if(OK(__MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(stream_))) {
       if(zero < stream_->length) {
         if(OK(__memset__(stream_, zero, sizeof(StreamBuffer_t)))) {
           RET_OK;
@@ -173,15 +202,15 @@ Return_t xStreamReset(const StreamBuffer_t *stream_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xStreamIsEmpty(const StreamBuffer_t *stream_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(stream_))) {
       if(zero < stream_->length) {
         *res_ = false;
         RET_OK;
@@ -196,15 +225,15 @@ Return_t xStreamIsEmpty(const StreamBuffer_t *stream_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xStreamIsFull(const StreamBuffer_t *stream_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(stream_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(stream_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(stream_))) {
       if(CONFIG_STREAM_BUFFER_BYTES == stream_->length) {
         *res_ = true;
         RET_OK;
@@ -219,5 +248,5 @@ Return_t xStreamIsFull(const StreamBuffer_t *stream_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
\ No newline at end of file
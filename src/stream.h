@@ -32,6 +32,7 @@
     extern "C" {
   #endif /* ifdef __cplusplus */
   Return_t xStreamCreate(StreamBuffer_t **stream_);
+  Return_t xStreamCreateStatic(StreamBuffer_t **stream_, Byte_t *storage_, const Size_t bytes_);
   Return_t xStreamDelete(const StreamBuffer_t *stream_);
   Return_t xStreamSend(StreamBuffer_t *stream_, const Byte_t byte_);
   Return_t xStreamReceive(const StreamBuffer_t *stream_, HalfWord_t *bytes_, Byte_t **data_);
@@ -38,19 +38,24 @@
 Flags_t flags;
 
 
+#if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+  static CriticalSectionStats_t criticalSectionStats[CRITICAL_SITES];
+#endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+
+
 Return_t xSystemAssert(const char *file_, const int line_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 #if defined(CONFIG_SYSTEM_ASSERT_BEHAVIOR)
     CONFIG_SYSTEM_ASSERT_BEHAVIOR(file_, line_);
     RET_OK;
 #endif /* if defined(CONFIG_SYSTEM_ASSERT_BEHAVIOR) */
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xSystemInit(void) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(OK(__MemoryInit__())) {
     if(OK(__PortInit__())) {
@@ -65,24 +70,24 @@ Return_t xSystemInit(void) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xSystemHalt(void) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
   DISABLE_INTERRUPTS();
 
   for(;;) {
     /* Do nothing - literally. */
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xSystemGetSystemInfo(SystemInfo_t **info_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(info_)) {
     if(OK(__HeapAllocateMemory__((volatile Addr_t **) info_, sizeof(SystemInfo_t)))) {
@@ -118,10 +123,116 @@ Return_t xSystemGetSystemInfo(SystemInfo_t **info_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
+}
+
+
+Return_t xSystemGetStaticSize(const StaticObject_t object_, Size_t *size_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(size_) && (STATIC_OBJECTS > ((Base_t) object_))) {
+    if(StaticObjectTask == object_) {
+      *size_ = STATIC_OBJECT_BYTES(sizeof(Task_t));
+    } else if(StaticObjectQueue == object_) {
+      *size_ = STATIC_OBJECT_BYTES(sizeof(Queue_t));
+    } else if(StaticObjectTimer == object_) {
+      *size_ = STATIC_OBJECT_BYTES(sizeof(Timer_t));
+    } else {
+      *size_ = STATIC_OBJECT_BYTES(sizeof(StreamBuffer_t));
+    }
+
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xSystemGetCriticalSectionStats(const CriticalSite_t site_, CriticalSectionStats_t **stats_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+
+    if(NOTNULLPTR(stats_) && (CRITICAL_SITES > ((Base_t) site_))) {
+      if(OK(__HeapAllocateMemory__((volatile Addr_t **) stats_, sizeof(CriticalSectionStats_t)))) {
+        if(NOTNULLPTR(*stats_)) {
+          if(OK(__memcpy__(*stats_, &criticalSectionStats[site_], sizeof(CriticalSectionStats_t)))) {
+            RET_OK;
+          } else {
+            ASSERT;
+
+
+            /* Free heap memory because __memcpy__() failed. */
+            __HeapFreeMemory__(*stats_);
+          }
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+
+    /* Critical section statistics are not being collected so there are no
+     * statistics to get. */
+    ASSERT;
+#endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+  SYSCALL_RETURN;
 }
 
 
+#if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+
+
+  /* Called by ENTER_CRITICAL() right after interrupts have been disabled.
+   * Critical sections may nest, such as when a FromISR() syscall interrupts
+   * the kernel, so the start timestamp is returned and kept by the caller
+   * rather than here. */
+  Word_t __CriticalSectionEnter__(void) {
+    return(__PortGetTimestamp__());
+  }
+
+
+  /* Called by EXIT_CRITICAL() right before interrupts are restored. */
+  void __CriticalSectionExit__(const CriticalSite_t site_, const Word_t start_) {
+    Word_t elapsed = zero;
+    Word_t bucket = zero;
+
+
+    /* Unsigned subtraction gives the right answer even if the timestamp
+     * wrapped while interrupts were disabled. */
+    elapsed = __PortGetTimestamp__() - start_;
+
+    if(CRITICAL_SITES > ((Base_t) site_)) {
+      criticalSectionStats[site_].count++;
+
+      if(criticalSectionStats[site_].maximum < elapsed) {
+        criticalSectionStats[site_].maximum = elapsed;
+      }
+
+
+      /* The histogram bucket is the position of the most significant bit of
+       * the elapsed time, saturating at the last bucket. */
+      while(((CRITICAL_SECTION_HISTOGRAM_BUCKETS - 1) > bucket) && (1u < (elapsed >> bucket))) {
+        bucket++;
+      }
+
+      criticalSectionStats[site_].histogram[bucket]++;
+    }
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+
+
 #if defined(POSIX_ARCH_OTHER)
 
 
@@ -129,6 +240,10 @@ Return_t xSystemGetSystemInfo(SystemInfo_t **info_) {
   void __SysStateClear__(void) {
     __memset__(&flags, 0x0, sizeof(Flags_t));
 
+  #if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+      __memset__(criticalSectionStats, 0x0, sizeof(criticalSectionStats));
+  #endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
+
     return;
   }
 
@@ -37,6 +37,13 @@
   Return_t xSystemInit(void);
   Return_t xSystemHalt(void);
   Return_t xSystemGetSystemInfo(SystemInfo_t **info_);
+  Return_t xSystemGetStaticSize(const StaticObject_t object_, Size_t *size_);
+  Return_t xSystemGetCriticalSectionStats(const CriticalSite_t site_, CriticalSectionStats_t **stats_);
+
+  #if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+    Word_t __CriticalSectionEnter__(void);
+    void __CriticalSectionExit__(const CriticalSite_t site_, const Word_t start_);
+  #endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
 
   #if defined(CONFIG_ENABLE_ARDUINO_CPP_INTERFACE)
     void __ArduinoAssert__(const char *file_, int line_);
@@ -19,55 +19,210 @@
 
 
 static TaskList_t *tlist = null;
-static void __RunTimeReset__(void);
+/* NOTE: The scheduler lists are zeroed by the C runtime and the heap slots are
+ * set by __SchedulerListsInit__() when the first task is created. */
+static SchedulerLists_t slist[CONFIG_SCHEDULER_CORES];
+#if !defined(CONFIG_TICKS_64BIT_ENABLE)
+  static void __RunTimeReset__(void);
+#endif /* if !defined(CONFIG_TICKS_64BIT_ENABLE) */
+static Return_t __TaskListPrepare__(void);
+static Return_t __TaskAdd__(Task_t *task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_);
 static void __TaskRun__(Task_t *task_);
+static void __TaskExecute__(Task_t *task_);
+static void __TimerTaskRun__(Task_t *task_, const Ticks_t now_);
+static void __TimerTaskRelease__(Task_t *task_, const Ticks_t now_);
 static Return_t __TaskListFindTask__(const Task_t *task_);
+static Return_t __TaskStateSet__(Task_t *task_, const TaskState_t state_);
+static Return_t __TaskCoreSet__(Task_t *task_, const Base_t core_);
+static Return_t __TimerHeapSync__(Task_t *task_);
+static Return_t __TaskHeapPush__(TaskHeap_t *heap_, Task_t *task_);
+static Return_t __TaskHeapGrow__(TaskHeap_t *heap_);
+static void __TaskHeapRemove__(TaskHeap_t *heap_, Task_t *task_);
+static void __TaskHeapUpdate__(TaskHeap_t *heap_, Task_t *task_);
+static Base_t __TaskHeapContains__(const TaskHeap_t *heap_, const Task_t *task_);
+static void __TaskHeapSiftUp__(TaskHeap_t *heap_, Base_t index_);
+static void __TaskHeapSiftDown__(TaskHeap_t *heap_, Base_t index_);
+static Base_t __TaskHeapLess__(const TaskHeap_t *heap_, const Task_t *a_, const Task_t *b_);
+static void __StateListLink__(Task_t *task_);
+static void __StateListUnlink__(Task_t *task_);
+static TaskStateList_t *__StateListFor__(const Task_t *task_);
+static void __NotificationBytesSet__(Task_t *task_, const Base_t bytes_);
+static Base_t __NotificationWaiting__(const Task_t *task_);
+static Base_t __NotificationPending__(const Task_t *task_);
+static void __SchedulerRun__(const Base_t core_);
+static void __SchedulerIdle__(const Base_t core_);
+static Base_t __SchedulerCore__(void);
+static void __SchedulerNotify__(const Task_t *task_);
+static void __SchedulerListsInit__(void);
+static Return_t __ReadyHeapPush__(Task_t *task_);
+static void __ReadyHeapRemove__(Task_t *task_);
+static Base_t __ReadyHeapHighest__(const Base_t core_);
+static void __TaskIndexLink__(Task_t *task_);
+static void __TaskIndexUnlink__(const Task_t *task_);
+static void __TaskDeletedFree__(const Base_t core_);
+static Return_t __TaskFree__(Task_t *task_);
+
+
+#if defined(CONFIG_TASK_INDEX_ENABLE)
+  static Base_t __TaskNameHash__(const Byte_t *name_);
+  static Base_t __TaskHandleHash__(const Task_t *task_);
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+  static Return_t __NotificationEventsGive__(Task_t *task_, const Word_t count_, const Word_t bits_);
+  static void __NotificationEventsTake__(Task_t *task_, Word_t *count_, Word_t *bits_);
+  static void __NotificationEventsSet__(Task_t *task_, const Base_t pending_);
+  static void __NotificationSignalledDrain__(void);
+  static void __NotificationSignalledRemove__(const Task_t *task_);
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+
+
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+  static void __TaskHistogramRecord__(Task_t *task_, const TaskHistogramId_t id_, Ticks_t ticks_);
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+
+
+#if defined(CONFIG_TRACE_ENABLE)
+  static void __TraceRecord__(const Task_t *task_, const TraceEventType_t event_, const Ticks_t time_);
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+  static Return_t __TaskAwait__(Task_t *task_, const Base_t ready_, const Base_t kind_, const volatile Addr_t *object_, const HalfWord_t bytes_, Base_t
+    *res_);
+  static void __TaskAwaitSet__(Task_t *task_, const Base_t kind_, const volatile Addr_t *object_, const HalfWord_t bytes_);
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+  static void __TaskStackfulEntry__(void);
+  static Return_t __TaskBlockAwait__(Task_t *task_, const Queue_t *queue_, const Ticks_t ticks_, Base_t *res_);
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+  static void __TaskExecuteThread__(volatile Addr_t *task_);
+  static Word_t __TaskRunWait__(void);
+  static void __SchedulerCoreThread__(const Base_t core_);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+  static void __UtilizationAdvance__(const Ticks_t now_);
+  static HalfWord_t __UtilizationOf__(const Ticks_t *slots_);
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+
+
+/* NOTE: Only the first core's scheduler state is initialized here. The others
+ * take the first core's state when xTaskStartSchedulerCores() starts them. */
+static SchedulerState_t schedulerState[CONFIG_SCHEDULER_CORES] = {
+  SchedulerStateRunning
+};
+static void (*idleHook)(void) = null;
+/* The idle time of each core is kept apart so it can be compared against the
+ * system ticks on its own. */
+static Ticks_t idleTime[CONFIG_SCHEDULER_CORES];
+/* When each core last stopped doing work, either because a task returned or
+ * because the time up to then was counted as idle. */
+static Ticks_t lastBusy[CONFIG_SCHEDULER_CORES];
+/* Tasks given a counting or bitwise notification since the scheduler last
+ * looked. These may be given from an interrupt so they are only pushed here,
+ * with interrupts disabled, and the scheduler moves them to the pending list.
+ * This is always empty unless CONFIG_TASK_NOTIFY_EVENTS_ENABLE is defined. */
+static Task_t *volatile notifySignalled = null;
+
+
+#if defined(CONFIG_TRACE_ENABLE)
+  static TraceEvent_t trace[CONFIG_TRACE_BUFFER_EVENTS];
+  static HalfWord_t traceNext = zero;
+  static HalfWord_t traceLength = zero;
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
 
 
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+  static Ticks_t utilizationIdle[CONFIG_SCHEDULER_CORES][CONFIG_TASK_UTILIZATION_SLOTS];
+  static Ticks_t utilizationSlotStart = zero;
+  static Ticks_t utilizationNow = zero;
+  static Base_t utilizationSlot = zero;
+  static Base_t utilizationSlots = zero;
+  static Base_t utilizationStarted = false;
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
 
-static SchedulerState_t schedulerState = SchedulerStateRunning;
 
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
 
-Return_t xTaskCreate(Task_t **task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_) {
-  RET_DEFINE;
+  /* The stackful task whose stack is in use, if any. */
+  static Task_t *stackfulTask = null;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
 
 
-  Task_t *cursor = null;
+#if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
 
+  /* The task list and, for each core, the storage of the ready heap of every
+   * priority level followed by the timer heap and, if enabled, the deadline
+   * heap. */
+  static TaskList_t tlistStatic;
+  static Task_t *heapStatic[CONFIG_SCHEDULER_CORES][CONFIG_TASK_PRIORITY_LEVELS + TASK_HEAPS - 0x1u][CONFIG_TASK_STATIC_HEAPS_TASKS];
+#endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
 
-  if(NOTNULLPTR(task_) && (NOTNULLPTR(name_)) && (NOTNULLPTR(callback_)) && (false == FLAG_RUNNING)) {
-    /* NOTE: There is a __KernelAllocateMemory__() syscall buried in this if()
-     * statement. */
-    if(NOTNULLPTR(tlist) || (NULLPTR(tlist) && OK(__KernelAllocateMemory__((volatile Addr_t **) &tlist, sizeof(TaskList_t))))) {
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+  static Base_t schedulerThreads = 0x1u;
+  static Base_t schedulerCores = 0x1u;
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+Return_t xTaskCreate(Task_t **task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(task_) && (NOTNULLPTR(name_)) && (NOTNULLPTR(callback_))) {
+    if(OK(__TaskListPrepare__())) {
       if(OK(__KernelAllocateMemory__((volatile Addr_t **) task_, sizeof(Task_t)))) {
         if(NOTNULLPTR(*task_)) {
-          if(OK(__memcpy__((*task_)->name, name_, CONFIG_TASK_NAME_BYTES))) {
-            tlist->nextId++;
-            (*task_)->id = tlist->nextId;
-            (*task_)->state = TaskStateSuspended;
-            (*task_)->callback = callback_;
-            (*task_)->taskParameter = taskParameter_;
-            (*task_)->next = null;
-            cursor = tlist->head;
-
-            if(NOTNULLPTR(tlist->head)) {
-              while(NOTNULLPTR(cursor->next)) {
-                cursor = cursor->next;
-              }
+          if(OK(__TaskAdd__(*task_, name_, callback_, taskParameter_))) {
+            RET_OK;
+          } else {
+            ASSERT;
 
-              cursor->next = *task_;
-            } else {
-              tlist->head = *task_;
-            }
 
-            tlist->length++;
+            /* Free kernel memory because __TaskAdd__() failed.*/
+            __KernelFreeMemory__(*task_);
+          }
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskCreateStatic(Task_t **task_, Byte_t *storage_, const Size_t bytes_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_),
+  TaskParm_t *taskParameter_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(task_) && (NOTNULLPTR(name_)) && (NOTNULLPTR(callback_))) {
+    if(OK(__TaskListPrepare__())) {
+      if(OK(__StaticAllocateMemory__((volatile Addr_t **) task_, storage_, bytes_, sizeof(Task_t)))) {
+        if(NOTNULLPTR(*task_)) {
+          if(OK(__TaskAdd__(*task_, name_, callback_, taskParameter_))) {
             RET_OK;
           } else {
             ASSERT;
 
 
-            /* Free kernel memory because __memcpy__() failed.*/
-            __KernelFreeMemory__(*task_);
+            /* Give the storage back because __TaskAdd__() failed.*/
+            __KernelObjectFree__(*task_);
           }
         } else {
           ASSERT;
@@ -82,46 +237,200 @@ Return_t xTaskCreate(Task_t **task_, const Byte_t *name_, void (*callback_)(Task
     ASSERT;
   }
 
+  SYSCALL_RETURN;
+}
+
+
+/* Creates the task list along with the first task. The task list is allocated
+ * from the kernel memory region unless CONFIG_TASK_STATIC_HEAPS_ENABLE is
+ * defined, in which case no more than CONFIG_TASK_STATIC_HEAPS_TASKS tasks
+ * may be created so the static heaps never need to grow. */
+static Return_t __TaskListPrepare__(void) {
+  RET_DEFINE;
+
+#if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+
+    if(NULLPTR(tlist)) {
+      if(OK(__memset__(&tlistStatic, 0x0, sizeof(TaskList_t)))) {
+        tlist = &tlistStatic;
+      } else {
+        ASSERT;
+      }
+    }
+
+    if(NOTNULLPTR(tlist) && (CONFIG_TASK_STATIC_HEAPS_TASKS > tlist->length)) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+
+    /* NOTE: There is a __KernelAllocateMemory__() syscall buried in this if()
+     * statement. */
+    if(NOTNULLPTR(tlist) || (NULLPTR(tlist) && OK(__KernelAllocateMemory__((volatile Addr_t **) &tlist, sizeof(TaskList_t))))) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+
+#endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
   RET_RETURN;
 }
 
 
-Return_t xTaskDelete(const Task_t *task_) {
+static Return_t __TaskAdd__(Task_t *task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_) {
   RET_DEFINE;
 
 
   Task_t *cursor = null;
-  Task_t *previous = null;
 
 
-  if(NOTNULLPTR(task_) && NOTNULLPTR(tlist) && (false == FLAG_RUNNING)) {
-    if(OK(__TaskListFindTask__(task_))) {
-      cursor = tlist->head;
+  if(OK(__memcpy__(task_->name, name_, CONFIG_TASK_NAME_BYTES))) {
+    /* The first task sets up the scheduler lists of every core. */
+    if(NULLPTR(tlist->head)) {
+      __SchedulerListsInit__();
+    }
+
+    tlist->nextId++;
+    task_->id = tlist->nextId;
+    task_->state = TaskStateSuspended;
+    task_->callback = callback_;
+    task_->taskParameter = taskParameter_;
+    task_->next = null;
+
+#if CONFIG_SCHEDULER_CORES > 0x1u
+
+      /* A task starts out on the core it was created from. */
+      task_->core = __SchedulerCore__();
+#endif /* if CONFIG_SCHEDULER_CORES > 0x1u */
+    __StateListLink__(task_);
+    __TaskIndexLink__(task_);
+    cursor = tlist->head;
+
+    if(NOTNULLPTR(tlist->head)) {
+      while(NOTNULLPTR(cursor->next)) {
+        cursor = cursor->next;
+      }
+
+      cursor->next = task_;
+    } else {
+      tlist->head = task_;
+    }
+
+    tlist->length++;
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+Return_t xTaskCreateWithPriority(Task_t **task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_, const
+  Base_t priority_) {
+  SYSCALL_DEFINE;
+
+  if(CONFIG_TASK_PRIORITY_LEVELS > priority_) {
+    if(OK(xTaskCreate(task_, name_, callback_, taskParameter_))) {
+#if CONFIG_TASK_PRIORITY_LEVELS > 0x1u
+
+        /* The new task is in the suspended state so it is not in a ready
+         * heap yet and its priority level can just be set. */
+        (*task_)->priority = priority_;
+#endif /* if CONFIG_TASK_PRIORITY_LEVELS > 0x1u */
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
 
-      if((NOTNULLPTR(cursor)) && (cursor == task_)) {
-        tlist->head = cursor->next;
+Return_t xTaskCreateStackful(Task_t **task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_, const
+  Size_t bytes_) {
+  SYSCALL_DEFINE;
 
-        if(OK(__KernelFreeMemory__(cursor))) {
-          tlist->length--;
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+    if(STACKFUL_STACK_MINIMUM_BYTES <= bytes_) {
+      if(OK(xTaskCreate(task_, name_, callback_, taskParameter_))) {
+        /* See xTaskSetAffinity(). The new task is in the suspended state so
+         * moving it to core zero cannot fail. */
+        __TaskCoreSet__(*task_, zero);
+
+        if(OK(__PortContextCreate__(&(*task_)->context, bytes_, __TaskStackfulEntry__))) {
           RET_OK;
         } else {
           ASSERT;
+
+
+          /* Delete the task because its stack could not be created. */
+          xTaskDelete(*task_);
         }
-      } else if((NOTNULLPTR(cursor)) && (cursor != task_)) {
-        while((NOTNULLPTR(cursor)) && (cursor != task_)) {
-          previous = cursor;
-          cursor = cursor->next;
-        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskDelete(const Task_t *task_) {
+  SYSCALL_DEFINE;
+
+
+  Task_t *cursor = null;
+  Task_t *previous = null;
+
+
+  if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
+    if(OK(__TaskListFindTask__(task_))) {
+      cursor = tlist->head;
+
+      while((NOTNULLPTR(cursor)) && (cursor != task_)) {
+        previous = cursor;
+        cursor = cursor->next;
+      }
 
-        if(NOTNULLPTR(cursor)) {
+      if(NOTNULLPTR(cursor)) {
+        if(NOTNULLPTR(previous)) {
           previous->next = cursor->next;
+        } else {
+          tlist->head = cursor->next;
+        }
 
-          if(OK(__KernelFreeMemory__(cursor))) {
-            tlist->length--;
-            RET_OK;
-          } else {
-            ASSERT;
-          }
+        __TaskStateSet__(cursor, TaskStateSuspended);
+        __StateListUnlink__(cursor);
+
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+          __NotificationSignalledRemove__(cursor);
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+        __TaskIndexUnlink__(cursor);
+        tlist->length--;
+
+
+        /* The task is gone as far as every syscall is concerned. However, if
+         * the scheduler is running, it may still be using the task (e.g., the
+         * task may have deleted itself) so leave freeing it to the scheduler
+         * at the end of its pass. */
+        if(true == FLAG_RUNNING) {
+          cursor->next = slist[TASK_CORE(cursor)].deleted;
+          slist[TASK_CORE(cursor)].deleted = cursor;
+          RET_OK;
+        } else if(OK(__TaskFree__(cursor))) {
+          RET_OK;
         } else {
           ASSERT;
         }
@@ -135,72 +444,118 @@ Return_t xTaskDelete(const Task_t *task_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetHandleByName(Task_t **task_, const Byte_t *name_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Task_t *cursor = null;
   Base_t res = false;
 
 
+#if defined(CONFIG_TASK_INDEX_ENABLE)
+    Base_t hash = zero;
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+
   if((NOTNULLPTR(task_)) && (NOTNULLPTR(name_)) && (NOTNULLPTR(tlist))) {
-    cursor = tlist->head;
+#if defined(CONFIG_TASK_INDEX_ENABLE)
 
-    while(NOTNULLPTR(cursor)) {
-      if(OK(__memcmp__(cursor->name, name_, CONFIG_TASK_NAME_BYTES, &res))) {
-        if(true == res) {
-          *task_ = cursor;
-          RET_OK;
+      /* Only the tasks in the name's bucket can have the name and, of those,
+       * only the ones with the same hash need their names compared. */
+      hash = __TaskNameHash__(name_);
+      cursor = tlist->names[hash % CONFIG_TASK_INDEX_BUCKETS];
+
+      while(NOTNULLPTR(cursor)) {
+        if(hash == cursor->nameHash) {
+          if(OK(__memcmp__(cursor->name, name_, CONFIG_TASK_NAME_BYTES, &res))) {
+            if(true == res) {
+              *task_ = cursor;
+              RET_OK;
+              break;
+            }
+          } else {
+            ASSERT;
+            break;
+          }
+        }
+
+        cursor = cursor->nameNext;
+      }
+
+#else  /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+      cursor = tlist->head;
+
+      while(NOTNULLPTR(cursor)) {
+        if(OK(__memcmp__(cursor->name, name_, CONFIG_TASK_NAME_BYTES, &res))) {
+          if(true == res) {
+            *task_ = cursor;
+            RET_OK;
+            break;
+          }
+        } else {
+          ASSERT;
           break;
         }
-      } else {
-        ASSERT;
-        break;
+
+        cursor = cursor->next;
       }
 
-      cursor = cursor->next;
-    }
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
   } else {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetHandleById(Task_t **task_, const Base_t id_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Task_t *cursor = null;
 
 
   if((NOTNULLPTR(task_)) && (zero < id_) && (NOTNULLPTR(tlist))) {
-    cursor = tlist->head;
+#if defined(CONFIG_TASK_INDEX_ENABLE)
 
-    while(NOTNULLPTR(cursor)) {
-      if(id_ == cursor->id) {
-        *task_ = cursor;
-        RET_OK;
-        break;
+      /* Task IDs are handed out in order so, until there are more tasks than
+       * buckets, every task has a bucket to itself. */
+      cursor = tlist->ids[id_ % CONFIG_TASK_INDEX_BUCKETS];
+
+      while((NOTNULLPTR(cursor)) && (id_ != cursor->id)) {
+        cursor = cursor->idNext;
       }
 
-      cursor = cursor->next;
+#else  /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+      cursor = tlist->head;
+
+      while((NOTNULLPTR(cursor)) && (id_ != cursor->id)) {
+        cursor = cursor->next;
+      }
+
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+    if(NOTNULLPTR(cursor)) {
+      *task_ = cursor;
+      RET_OK;
+    } else {
+      ASSERT;
     }
   } else {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetAllRunTimeStats(TaskRunTimeStats_t **stats_, Base_t *tasks_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
 
   Base_t task = zero;
@@ -225,6 +580,14 @@ Return_t xTaskGetAllRunTimeStats(TaskRunTimeStats_t **stats_, Base_t *tasks_) {
             (*stats_)[task].id = cursor->id;
             (*stats_)[task].lastRunTime = cursor->lastRunTime;
             (*stats_)[task].totalRunTime = cursor->totalRunTime;
+
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+              (*stats_)[task].deadlineMisses = cursor->deadlineMisses;
+              (*stats_)[task].releases = cursor->releases;
+              (*stats_)[task].overruns = cursor->overruns;
+              (*stats_)[task].maximumReleaseJitter = cursor->maximumReleaseJitter;
+              (*stats_)[task].totalReleaseJitter = cursor->totalReleaseJitter;
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
             cursor = cursor->next;
             task++;
           }
@@ -244,12 +607,12 @@ Return_t xTaskGetAllRunTimeStats(TaskRunTimeStats_t **stats_, Base_t *tasks_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetTaskRunTimeStats(const Task_t *task_, TaskRunTimeStats_t **stats_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(stats_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
@@ -258,6 +621,14 @@ Return_t xTaskGetTaskRunTimeStats(const Task_t *task_, TaskRunTimeStats_t **stat
           (*stats_)->id = task_->id;
           (*stats_)->lastRunTime = task_->lastRunTime;
           (*stats_)->totalRunTime = task_->totalRunTime;
+
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+            (*stats_)->deadlineMisses = task_->deadlineMisses;
+            (*stats_)->releases = task_->releases;
+            (*stats_)->overruns = task_->overruns;
+            (*stats_)->maximumReleaseJitter = task_->maximumReleaseJitter;
+            (*stats_)->totalReleaseJitter = task_->totalReleaseJitter;
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
           RET_OK;
         } else {
           ASSERT;
@@ -272,59 +643,59 @@ Return_t xTaskGetTaskRunTimeStats(const Task_t *task_, TaskRunTimeStats_t **stat
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
-Return_t xTaskGetNumberOfTasks(Base_t *tasks_) {
-  RET_DEFINE;
+Return_t xTaskGetLatencyHistogram(const Task_t *task_, const TaskHistogramId_t id_, TaskHistogram_t **histogram_) {
+  SYSCALL_DEFINE;
 
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
 
-  Base_t tasks = zero;
-  Task_t *cursor = null;
 
+    Base_t bucket = zero;
+    Word_t count = zero;
 
-  if(NOTNULLPTR(tasks_) && NOTNULLPTR(tlist)) {
-    cursor = tlist->head;
 
-    while(NOTNULLPTR(cursor)) {
-      tasks++;
-      cursor = cursor->next;
-    }
+    if(NOTNULLPTR(task_) && NOTNULLPTR(histogram_) && NOTNULLPTR(tlist) && (TASK_HISTOGRAMS > ((Base_t) id_))) {
+      if(OK(__TaskListFindTask__(task_))) {
+        if(OK(__HeapAllocateMemory__((volatile Addr_t **) histogram_, sizeof(TaskHistogram_t)))) {
+          if(NOTNULLPTR(*histogram_)) {
+            if(OK(__memcpy__((*histogram_)->histogram, task_->histogram[id_], TASK_HISTOGRAM_BUCKETS * sizeof(Word_t)))) {
+              (*histogram_)->count = zero;
+              (*histogram_)->maximum = task_->histogramMaximum[id_];
+
+              for(bucket = zero; bucket < TASK_HISTOGRAM_BUCKETS; bucket++) {
+                (*histogram_)->count += (*histogram_)->histogram[bucket];
+              }
 
-    if(tasks == tlist->length) {
-      *tasks_ = tasks;
-      RET_OK;
-    } else {
-      ASSERT;
-    }
-  } else {
-    ASSERT;
-  }
 
-  RET_RETURN;
-}
+              /* Find the bucket the 99th percentile falls in. Its upper bound
+               * is the 99th percentile unless the maximum is less. */
+              for(bucket = zero; bucket < TASK_HISTOGRAM_BUCKETS; bucket++) {
+                count += (*histogram_)->histogram[bucket];
 
+                if((zero < count) && (count >= ((*histogram_)->count - ((*histogram_)->count / 100u)))) {
+                  break;
+                }
+              }
 
-Return_t xTaskGetTaskInfo(const Task_t *task_, TaskInfo_t **info_) {
-  RET_DEFINE;
+              if((bucket < (TASK_HISTOGRAM_BUCKETS - 1)) && ((((Ticks_t) 2u << bucket) - 1u) < (*histogram_)->maximum)) {
+                (*histogram_)->percentile99 = ((Ticks_t) 2u << bucket) - 1u;
+              } else {
+                (*histogram_)->percentile99 = (*histogram_)->maximum;
+              }
 
-  if(NOTNULLPTR(task_) && NOTNULLPTR(info_) && NOTNULLPTR(tlist)) {
-    if(OK(__TaskListFindTask__(task_))) {
-      if(OK(__HeapAllocateMemory__((volatile Addr_t **) info_, sizeof(TaskInfo_t)))) {
-        if(NOTNULLPTR(*info_)) {
-          if(OK(__memcpy__((*info_)->name, task_->name, CONFIG_TASK_NAME_BYTES))) {
-            (*info_)->id = task_->id;
-            (*info_)->state = task_->state;
-            (*info_)->lastRunTime = task_->lastRunTime;
-            (*info_)->totalRunTime = task_->totalRunTime;
-            RET_OK;
-          } else {
-            ASSERT;
+              RET_OK;
+            } else {
+              ASSERT;
 
 
-            /* Free heap memory because __memcpy__() failed. */
-            __HeapFreeMemory__(*info_);
+              /* Free heap memory because __memcpy__() failed. */
+              __HeapFreeMemory__(*histogram_);
+            }
+          } else {
+            ASSERT;
           }
         } else {
           ASSERT;
@@ -335,25 +706,156 @@ Return_t xTaskGetTaskInfo(const Task_t *task_, TaskInfo_t **info_) {
     } else {
       ASSERT;
     }
-  } else {
-    ASSERT;
-  }
 
-  RET_RETURN;
+#else  /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+
+    /* Task latency histograms are not being kept so there are no histograms to
+     * get. */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+  SYSCALL_RETURN;
 }
 
 
-Return_t xTaskGetAllTaskInfo(TaskInfo_t **info_, Base_t *tasks_) {
-  RET_DEFINE;
+Return_t xTaskGetTrace(TraceEvent_t **events_, HalfWord_t *count_) {
+  SYSCALL_DEFINE;
 
+#if defined(CONFIG_TRACE_ENABLE)
 
-  Base_t task = zero;
-  Base_t tasks = zero;
-  Task_t *cursor = null;
 
+    HalfWord_t event = zero;
+    HalfWord_t oldest = zero;
 
-  if(NOTNULLPTR(info_) && (NOTNULLPTR(tasks_)) && NOTNULLPTR(tlist)) {
-    cursor = tlist->head;
+
+    if(NOTNULLPTR(events_) && NOTNULLPTR(count_) && (zero < traceLength)) {
+      if(OK(__HeapAllocateMemory__((volatile Addr_t **) events_, traceLength * sizeof(TraceEvent_t)))) {
+        if(NOTNULLPTR(*events_)) {
+          /* Once the trace buffer is full the oldest event is the one the next
+           * event will overwrite. */
+          oldest = (HalfWord_t) ((traceNext + CONFIG_TRACE_BUFFER_EVENTS - traceLength) % CONFIG_TRACE_BUFFER_EVENTS);
+
+          for(event = zero; event < traceLength; event++) {
+            (*events_)[event] = trace[(oldest + event) % CONFIG_TRACE_BUFFER_EVENTS];
+          }
+
+          *count_ = traceLength;
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TRACE_ENABLE) */
+
+    /* The scheduler event trace is not being kept so there are no events to
+     * get. */
+    ASSERT;
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskClearTrace(void) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TRACE_ENABLE)
+    traceNext = zero;
+    traceLength = zero;
+    RET_OK;
+#else  /* if defined(CONFIG_TRACE_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetNumberOfTasks(Base_t *tasks_) {
+  SYSCALL_DEFINE;
+
+
+  Base_t tasks = zero;
+  Task_t *cursor = null;
+
+
+  if(NOTNULLPTR(tasks_) && NOTNULLPTR(tlist)) {
+    cursor = tlist->head;
+
+    while(NOTNULLPTR(cursor)) {
+      tasks++;
+      cursor = cursor->next;
+    }
+
+    if(tasks == tlist->length) {
+      *tasks_ = tasks;
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetTaskInfo(const Task_t *task_, TaskInfo_t **info_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(task_) && NOTNULLPTR(info_) && NOTNULLPTR(tlist)) {
+    if(OK(__TaskListFindTask__(task_))) {
+      if(OK(__HeapAllocateMemory__((volatile Addr_t **) info_, sizeof(TaskInfo_t)))) {
+        if(NOTNULLPTR(*info_)) {
+          if(OK(__memcpy__((*info_)->name, task_->name, CONFIG_TASK_NAME_BYTES))) {
+            (*info_)->id = task_->id;
+            (*info_)->state = task_->state;
+            (*info_)->lastRunTime = task_->lastRunTime;
+            (*info_)->totalRunTime = task_->totalRunTime;
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+              __UtilizationAdvance__(__PortGetSysTicks__());
+              (*info_)->utilization = __UtilizationOf__(task_->utilization);
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+            RET_OK;
+          } else {
+            ASSERT;
+
+
+            /* Free heap memory because __memcpy__() failed. */
+            __HeapFreeMemory__(*info_);
+          }
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetAllTaskInfo(TaskInfo_t **info_, Base_t *tasks_) {
+  SYSCALL_DEFINE;
+
+
+  Base_t task = zero;
+  Base_t tasks = zero;
+  Task_t *cursor = null;
+
+
+  if(NOTNULLPTR(info_) && (NOTNULLPTR(tasks_)) && NOTNULLPTR(tlist)) {
+    cursor = tlist->head;
 
     while(NOTNULLPTR(cursor)) {
       tasks++;
@@ -363,6 +865,9 @@ Return_t xTaskGetAllTaskInfo(TaskInfo_t **info_, Base_t *tasks_) {
     if((zero < tasks) && (tasks == tlist->length)) {
       if(OK(__HeapAllocateMemory__((volatile Addr_t **) info_, tasks * sizeof(TaskInfo_t)))) {
         if(NOTNULLPTR(*info_)) {
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+            __UtilizationAdvance__(__PortGetSysTicks__());
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
           cursor = tlist->head;
 
           while(NOTNULLPTR(cursor)) {
@@ -371,6 +876,9 @@ Return_t xTaskGetAllTaskInfo(TaskInfo_t **info_, Base_t *tasks_) {
               (*info_)[task].state = cursor->state;
               (*info_)[task].lastRunTime = cursor->lastRunTime;
               (*info_)[task].totalRunTime = cursor->totalRunTime;
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+                (*info_)[task].utilization = __UtilizationOf__(cursor->utilization);
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
               cursor = cursor->next;
               task++;
             }
@@ -391,12 +899,12 @@ Return_t xTaskGetAllTaskInfo(TaskInfo_t **info_, Base_t *tasks_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetTaskState(const Task_t *task_, TaskState_t *state_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(state_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
@@ -409,12 +917,12 @@ Return_t xTaskGetTaskState(const Task_t *task_, TaskState_t *state_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetName(const Task_t *task_, Byte_t **name_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(name_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
@@ -442,12 +950,12 @@ Return_t xTaskGetName(const Task_t *task_, Byte_t **name_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetId(const Task_t *task_, Base_t *id_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(id_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
@@ -460,18 +968,31 @@ Return_t xTaskGetId(const Task_t *task_, Base_t *id_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskNotifyStateClear(Task_t *task_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
+
+
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+
+    Word_t count = zero;
+    Word_t bits = zero;
+
+
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
-      if(zero < task_->notificationBytes) {
+      if(true == __NotificationWaiting__(task_)) {
         if(OK(__memset__(task_->notificationValue, zero, CONFIG_NOTIFICATION_VALUE_BYTES))) {
-          task_->notificationBytes = zero;
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+            __NotificationEventsTake__(task_, &count, &bits);
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+          __NotificationBytesSet__(task_, zero);
           RET_OK;
         } else {
           ASSERT;
@@ -486,16 +1007,16 @@ Return_t xTaskNotifyStateClear(Task_t *task_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskNotificationIsWaiting(const Task_t *task_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(res_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
-      if(zero < task_->notificationBytes) {
+      if(true == __NotificationWaiting__(task_)) {
         *res_ = true;
         RET_OK;
       } else {
@@ -509,18 +1030,21 @@ Return_t xTaskNotificationIsWaiting(const Task_t *task_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskNotifyGive(Task_t *task_, const Base_t bytes_, const Byte_t *value_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && (zero < bytes_) && (CONFIG_NOTIFICATION_VALUE_BYTES >= bytes_) && (NOTNULLPTR(value_)) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
       if(zero == task_->notificationBytes) {
         if(OK(__memcpy__(task_->notificationValue, value_, CONFIG_NOTIFICATION_VALUE_BYTES))) {
-          task_->notificationBytes = bytes_;
+          __NotificationBytesSet__(task_, bytes_);
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+            task_->notificationTime = __PortGetSysTicks__();
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
           RET_OK;
         } else {
           ASSERT;
@@ -535,12 +1059,12 @@ Return_t xTaskNotifyGive(Task_t *task_, const Base_t bytes_, const Byte_t *value
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskNotifyTake(Task_t *task_, TaskNotification_t **notification_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(notification_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
@@ -550,7 +1074,7 @@ Return_t xTaskNotifyTake(Task_t *task_, TaskNotification_t **notification_) {
             if(OK(__memcpy__((*notification_)->notificationValue, task_->notificationValue, CONFIG_NOTIFICATION_VALUE_BYTES))) {
               if(OK(__memset__(task_->notificationValue, zero, CONFIG_NOTIFICATION_VALUE_BYTES))) {
                 (*notification_)->notificationBytes = task_->notificationBytes;
-                task_->notificationBytes = zero;
+                __NotificationBytesSet__(task_, zero);
                 RET_OK;
               } else {
                 ASSERT;
@@ -582,17 +1106,164 @@ Return_t xTaskNotifyTake(Task_t *task_, TaskNotification_t **notification_) {
     ASSERT;
   }
 
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskNotifyGiveCount(Task_t *task_) {
+  SYSCALL_DEFINE;
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        if(OK(__NotificationEventsGive__(task_, 0x1u, zero))) {
+          __SchedulerNotify__(task_);
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskNotifyTakeCount(Task_t *task_, Word_t *count_) {
+  SYSCALL_DEFINE;
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(count_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        __NotificationEventsTake__(task_, count_, null);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskNotifyGiveBits(Task_t *task_, const Word_t bits_) {
+  SYSCALL_DEFINE;
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+    if(NOTNULLPTR(task_) && (zero != bits_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        if(OK(__NotificationEventsGive__(task_, zero, bits_))) {
+          __SchedulerNotify__(task_);
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskNotifyTakeBits(Task_t *task_, Word_t *bits_) {
+  SYSCALL_DEFINE;
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(bits_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        __NotificationEventsTake__(task_, null, bits_);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+/* NOTE: The FromISR() syscalls neither take the kernel lock nor look the task
+ * up, so the task must be valid and must not be deleted while an interrupt may
+ * give it a notification. */
+Return_t xTaskNotifyGiveCountFromISR(Task_t *task_) {
+  RET_DEFINE;
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+    if(NOTNULLPTR(task_)) {
+      if(OK(__NotificationEventsGive__(task_, 0x1u, zero))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
   RET_RETURN;
 }
 
 
-Return_t xTaskResume(Task_t *task_) {
+Return_t xTaskNotifyGiveBitsFromISR(Task_t *task_, const Word_t bits_) {
   RET_DEFINE;
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+    if(NOTNULLPTR(task_) && (zero != bits_)) {
+      if(OK(__NotificationEventsGive__(task_, zero, bits_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+  RET_RETURN;
+}
+
+
+Return_t xTaskResume(Task_t *task_) {
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
-      task_->state = TaskStateRunning;
-      RET_OK;
+      if(OK(__TaskStateSet__(task_, TaskStateRunning))) {
+#if defined(CONFIG_TRACE_ENABLE)
+          __TraceRecord__(task_, TraceEventResume, __PortGetSysTicks__());
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+        RET_OK;
+      } else {
+        ASSERT;
+      }
     } else {
       ASSERT;
     }
@@ -600,17 +1271,23 @@ Return_t xTaskResume(Task_t *task_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskSuspend(Task_t *task_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
-      task_->state = TaskStateSuspended;
-      RET_OK;
+      if(OK(__TaskStateSet__(task_, TaskStateSuspended))) {
+#if defined(CONFIG_TRACE_ENABLE)
+          __TraceRecord__(task_, TraceEventSuspend, __PortGetSysTicks__());
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+        RET_OK;
+      } else {
+        ASSERT;
+      }
     } else {
       ASSERT;
     }
@@ -618,17 +1295,20 @@ Return_t xTaskSuspend(Task_t *task_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskWait(Task_t *task_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
-      task_->state = TaskStateWaiting;
-      RET_OK;
+      if(OK(__TaskStateSet__(task_, TaskStateWaiting))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
     } else {
       ASSERT;
     }
@@ -636,17 +1316,28 @@ Return_t xTaskWait(Task_t *task_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskChangePeriod(Task_t *task_, const Ticks_t period_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
+      /* A task timer that was not running starts now so its first period is a
+       * whole one rather than however long the system has been up. */
+      if(zero == task_->timerPeriod) {
+        task_->timerStartTime = __PortGetSysTicks__();
+      }
+
       task_->timerPeriod = period_;
-      RET_OK;
+
+      if(OK(__TimerHeapSync__(task_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
     } else {
       ASSERT;
     }
@@ -654,12 +1345,12 @@ Return_t xTaskChangePeriod(Task_t *task_, const Ticks_t period_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskChangeWDPeriod(Task_t *task_, const Ticks_t period_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 #if defined(CONFIG_TASK_WD_TIMER_ENABLE)
 
     if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
@@ -674,12 +1365,12 @@ Return_t xTaskChangeWDPeriod(Task_t *task_, const Ticks_t period_) {
     }
 
 #endif /* if defined(CONFIG_TASK_WD_TIMER_ENABLE) */
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTaskGetPeriod(const Task_t *task_, Ticks_t *period_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(task_) && NOTNULLPTR(period_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
@@ -692,30 +1383,18 @@ Return_t xTaskGetPeriod(const Task_t *task_, Ticks_t *period_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
-static Return_t __TaskListFindTask__(const Task_t *task_) {
-  RET_DEFINE;
-
-
-  Task_t *cursor = null;
-
+Return_t xTaskChangeReleasePolicy(Task_t *task_, const TaskReleasePolicy_t policy_) {
+  SYSCALL_DEFINE;
 
-  if((NOTNULLPTR(task_)) && (NOTNULLPTR(tlist))) {
-    if(OK(__MemoryRegionCheckKernel__(task_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
-      cursor = tlist->head;
-
-      while((NOTNULLPTR(cursor)) && (cursor != task_)) {
-        cursor = cursor->next;
-      }
-
-      if(NOTNULLPTR(cursor)) {
-        RET_OK;
-      } else {
-        ASSERT;
-      }
+  if(NOTNULLPTR(task_) && NOTNULLPTR(tlist) && ((TaskReleasePolicyRelative == policy_) || (TaskReleasePolicyCatchUp == policy_) || (TaskReleasePolicySkip ==
+    policy_))) {
+    if(OK(__TaskListFindTask__(task_))) {
+      task_->releasePolicy = policy_;
+      RET_OK;
     } else {
       ASSERT;
     }
@@ -723,16 +1402,16 @@ static Return_t __TaskListFindTask__(const Task_t *task_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
-Return_t xTaskResetTimer(Task_t *task_) {
-  RET_DEFINE;
+Return_t xTaskGetReleasePolicy(const Task_t *task_, TaskReleasePolicy_t *policy_) {
+  SYSCALL_DEFINE;
 
-  if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
+  if(NOTNULLPTR(task_) && NOTNULLPTR(policy_) && NOTNULLPTR(tlist)) {
     if(OK(__TaskListFindTask__(task_))) {
-      task_->timerStartTime = __PortGetSysTicks__();
+      *policy_ = task_->releasePolicy;
       RET_OK;
     } else {
       ASSERT;
@@ -741,151 +1420,249 @@ Return_t xTaskResetTimer(Task_t *task_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
-Return_t xTaskStartScheduler(void) {
-  RET_DEFINE;
+Return_t xTaskChangePriority(Task_t *task_, const Base_t priority_) {
+  SYSCALL_DEFINE;
 
+#if CONFIG_TASK_PRIORITY_LEVELS > 0x1u
 
-  Task_t *runTask = null;
-  Task_t *cursor = null;
 
+    Base_t previous = zero;
 
-  /* Intentionally underflow to get the maximum value of Ticks_t. */
-  Ticks_t least = -1;
 
+#endif /* if CONFIG_TASK_PRIORITY_LEVELS > 0x1u */
 
-  if((false == FLAG_RUNNING) && (NOTNULLPTR(tlist))) {
-    while(SchedulerStateRunning == schedulerState) {
-      /* If the total runtime on a task has overflowed, reset the total runtime
-       * for all tasks to their last runtime. */
-      if(true == FLAG_OVERFLOW) {
-        __RunTimeReset__();
-      }
+  if(NOTNULLPTR(task_) && NOTNULLPTR(tlist) && (CONFIG_TASK_PRIORITY_LEVELS > priority_)) {
+    if(OK(__TaskListFindTask__(task_))) {
+#if CONFIG_TASK_PRIORITY_LEVELS > 0x1u
+
+        if(TaskStateRunning == task_->state) {
+          /* Move the task to the ready heap for its new priority level. If
+           * the ready heap for the new priority level could not be grown, put
+           * the task back where it was, which cannot fail because the task
+           * was just removed from there. */
+          previous = task_->priority;
+          __ReadyHeapRemove__(task_);
+          task_->priority = priority_;
+
+          if(OK(__ReadyHeapPush__(task_))) {
+            RET_OK;
+          } else {
+            ASSERT;
+            task_->priority = previous;
+            __ReadyHeapPush__(task_);
+          }
+        } else {
+          task_->priority = priority_;
+          RET_OK;
+        }
 
-      cursor = tlist->head;
+#else  /* if CONFIG_TASK_PRIORITY_LEVELS > 0x1u */
 
-      while(NOTNULLPTR(cursor)) {
-        /* If the task is in a waiting state *AND* has a waiting notification,
-         * then run the task. */
-        if((TaskStateWaiting == cursor->state) && (zero < cursor->notificationBytes)) {
-          __TaskRun__(cursor);
+        /* With only one priority level every task is already in it. */
+        RET_OK;
+#endif /* if CONFIG_TASK_PRIORITY_LEVELS > 0x1u */
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetPriority(const Task_t *task_, Base_t *priority_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(task_) && NOTNULLPTR(priority_) && NOTNULLPTR(tlist)) {
+    if(OK(__TaskListFindTask__(task_))) {
+      *priority_ = TASK_PRIORITY(task_);
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
 
 
-          /* If the task is in a waiting state *AND* the task timer has elapsed,
-           * then run the task. */
-        } else if((TaskStateWaiting == cursor->state) && (zero < cursor->timerPeriod) && ((__PortGetSysTicks__() - cursor->timerStartTime) >
-          cursor->timerPeriod)) {
-          __TaskRun__(cursor);
-          cursor->timerStartTime = __PortGetSysTicks__();
+Return_t xTaskSetAffinity(Task_t *task_, const Base_t core_) {
+  SYSCALL_DEFINE;
 
+  /* Tasks are pinned to their cores before the scheduler is started so a task
+   * is never run by two cores at once. */
+  if(NOTNULLPTR(task_) && NOTNULLPTR(tlist) && (CONFIG_SCHEDULER_CORES > core_) && (false == FLAG_RUNNING)) {
+    if(OK(__TaskListFindTask__(task_))) {
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
 
-          /* If the task is in the running state *AND* its total runtime is less
-           * than the least runtime of the tasks thus far, then update lest
-           * runtime and remember the task because it will get ran later if it
-           * is in fact the task with the least runtime. */
-        } else if((TaskStateRunning == cursor->state) && (least > cursor->totalRunTime)) {
-          least = cursor->totalRunTime;
-          runTask = cursor;
+        /* Stackful tasks switch stacks on the thread that started the
+         * scheduler so they stay on core zero. */
+        if(NULLPTR(task_->context) || (zero == core_)) {
+          if(OK(__TaskCoreSet__(task_, core_))) {
+            RET_OK;
+          } else {
+            ASSERT;
+          }
+        } else {
+          ASSERT;
         }
 
-        cursor = cursor->next;
-      }
+#else  /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
 
-      /* If a running task was found with the least runtime of all of the
-       * running tasks then we run it here, otherwise we ignore this step. */
-      if(NOTNULLPTR(runTask)) {
-        __TaskRun__(runTask);
-        runTask = null;
-      }
+        if(OK(__TaskCoreSet__(task_, core_))) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
 
-      /* Intentionally underflow to get the maximum value of Ticks_t. */
-      least = -1;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+    } else {
+      ASSERT;
     }
-
-    FLAG_RUNNING = false;
-    RET_OK;
   } else {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
-static void __RunTimeReset__(void) {
-  Task_t *cursor = null;
-
-
-  cursor = tlist->head;
+Return_t xTaskGetAffinity(const Task_t *task_, Base_t *core_) {
+  SYSCALL_DEFINE;
 
-  /* Go through all of the tasks and set their total runtime to their last
-   * runtime. */
-  while(NOTNULLPTR(cursor)) {
-    cursor->totalRunTime = cursor->lastRunTime;
-    cursor = cursor->next;
+  if(NOTNULLPTR(task_) && NOTNULLPTR(core_) && NOTNULLPTR(tlist)) {
+    if(OK(__TaskListFindTask__(task_))) {
+      *core_ = TASK_CORE(task_);
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
   }
 
-  FLAG_OVERFLOW = false;
-
-  return;
+  SYSCALL_RETURN;
 }
 
 
-static void __TaskRun__(Task_t *task_) {
-  Ticks_t start = zero;
-  Ticks_t prev = zero;
-
+static Return_t __TaskCoreSet__(Task_t *task_, const Base_t core_) {
+  RET_DEFINE;
 
-  /* Store the previous total runtime to detect for overflow later. */
-  prev = task_->totalRunTime;
+#if CONFIG_SCHEDULER_CORES > 0x1u
 
 
-  /* Capture the start time of the task in ticks. */
-  start = __PortGetSysTicks__();
+    Base_t previous = zero;
 
 
-  /* Call the task main function through it's callback. */
-  (*task_->callback)(task_, task_->taskParameter);
+    previous = task_->core;
 
+    if(core_ == previous) {
+      RET_OK;
+    } else if(TaskStateRunning == task_->state) {
+      /* Move the task to the ready heap of the new core. If it could not be
+       * grown, put the task back where it was, which cannot fail because the
+       * task was just removed from there. */
+      __ReadyHeapRemove__(task_);
+      task_->core = core_;
+
+      if(OK(__ReadyHeapPush__(task_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+        task_->core = previous;
+        __ReadyHeapPush__(task_);
+      }
+    } else {
+      /* Move the task from the state list and timer heap of the old core to
+       * those of the new one, and back again if the timer heap of the new core
+       * could not be grown. */
+      __StateListUnlink__(task_);
 
-  /* Capture the task runtime by subtracting the start time from the end time.
-   */
-  task_->lastRunTime = __PortGetSysTicks__() - start;
+      if(__TaskHeapContains__(&slist[previous].timer, task_)) {
+        __TaskHeapRemove__(&slist[previous].timer, task_);
+      }
 
+#if defined(CONFIG_TASK_EDF_ENABLE)
 
-  /* Add the last runtime to the total runtime. */
-  task_->totalRunTime += task_->lastRunTime;
+        if(__TaskHeapContains__(&slist[previous].deadline, task_)) {
+          __TaskHeapRemove__(&slist[previous].deadline, task_);
+        }
 
-#if defined(CONFIG_TASK_WD_TIMER_ENABLE)
+#endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+      task_->core = core_;
+      __StateListLink__(task_);
 
-    /* If the task WD timer feature is enabled, if the WD timer period is
-     * greater than zero *AND*
-     *  the last runtime exceeded the WD timer period, then suspend the task. */
-    if((zero < task_->wdTimerPeriod) && (task_->lastRunTime > task_->wdTimerPeriod)) {
-      task_->state = TaskStateSuspended;
+      if(OK(__TimerHeapSync__(task_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+        __StateListUnlink__(task_);
+        task_->core = previous;
+        __StateListLink__(task_);
+        __TimerHeapSync__(task_);
+      }
     }
 
-#endif /* if defined(CONFIG_TASK_WD_TIMER_ENABLE) */
+#else  /* if CONFIG_SCHEDULER_CORES > 0x1u */
 
-  /* Detect overflow of total runtime. If an overflow occurs, then set the
-   * overflow flag to true. */
-  if(task_->totalRunTime < prev) {
-    FLAG_OVERFLOW = true;
-  }
+    /* With only one core every task is already on it. */
+    if(zero == core_) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
 
-  return;
+#endif /* if CONFIG_SCHEDULER_CORES > 0x1u */
+
+  RET_RETURN;
 }
 
 
-Return_t xTaskResumeAll(void) {
+static Return_t __TaskListFindTask__(const Task_t *task_) {
   RET_DEFINE;
 
-  if(NOTNULLPTR(tlist)) {
-    schedulerState = SchedulerStateRunning;
-    RET_OK;
+
+  Task_t *cursor = null;
+
+
+  if((NOTNULLPTR(task_)) && (NOTNULLPTR(tlist))) {
+#if defined(CONFIG_TASK_INDEX_ENABLE)
+
+      /* Tasks are indexed by the address of their task object so the task is
+       * valid if, and only if, it is in the bucket for its address. Only the
+       * address is used to find the bucket so a stale or forged task is never
+       * dereferenced. */
+      cursor = tlist->handles[__TaskHandleHash__(task_) % CONFIG_TASK_INDEX_BUCKETS];
+
+      while((NOTNULLPTR(cursor)) && (cursor != task_)) {
+        cursor = cursor->handleNext;
+      }
+
+#else  /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+      /* The task is only compared by address so a stale or forged task is
+       * never dereferenced. */
+      cursor = tlist->head;
+
+      while((NOTNULLPTR(cursor)) && (cursor != task_)) {
+        cursor = cursor->next;
+      }
+
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+    if(NOTNULLPTR(cursor)) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
   } else {
     ASSERT;
   }
@@ -894,60 +1671,2431 @@ Return_t xTaskResumeAll(void) {
 }
 
 
-Return_t xTaskSuspendAll(void) {
-  RET_DEFINE;
+Return_t xTaskResetTimer(Task_t *task_) {
+  SYSCALL_DEFINE;
 
-  if(NOTNULLPTR(tlist)) {
-    schedulerState = SchedulerStateSuspended;
-    RET_OK;
+  if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
+    if(OK(__TaskListFindTask__(task_))) {
+      task_->timerStartTime = __PortGetSysTicks__();
+
+      if(OK(__TimerHeapSync__(task_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
   } else {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
-Return_t xTaskGetSchedulerState(SchedulerState_t *state_) {
-  RET_DEFINE;
+Return_t xTaskStartScheduler(void) {
+  SYSCALL_DEFINE;
+
+
+  Base_t core = zero;
+
+
+  if((false == FLAG_RUNNING) && (NOTNULLPTR(tlist))) {
+    /* While the scheduler is running, xTaskDelete() leaves freeing tasks to
+     * the scheduler. */
+    FLAG_RUNNING = true;
+    __SchedulerRun__(zero);
+    FLAG_RUNNING = false;
+
+
+    /* Tasks deleted from the cores that were not run are freed now. */
+    for(core = zero; core < CONFIG_SCHEDULER_CORES; core++) {
+      __TaskDeletedFree__(core);
+    }
 
-  if(NOTNULLPTR(tlist)) {
-    *state_ = schedulerState;
     RET_OK;
   } else {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
-Return_t xTaskGetWDPeriod(const Task_t *task_, Ticks_t *period_) {
-  RET_DEFINE;
-#if defined(CONFIG_TASK_WD_TIMER_ENABLE)
+static void __SchedulerRun__(const Base_t core_) {
+  Task_t *cursor = null;
+  Ticks_t now = zero;
 
-    if(NOTNULLPTR(task_) && NOTNULLPTR(period_) && NOTNULLPTR(tlist)) {
-      if(OK(__TaskListFindTask__(task_))) {
-        *period_ = task_->wdTimerPeriod;
-        RET_OK;
-      } else {
-        ASSERT;
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    Base_t level = zero;
+    Base_t index = zero;
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+  /* Idle time is only counted from when the scheduler started. */
+  lastBusy[core_] = __PortGetSysTicks__();
+
+  while(SchedulerStateRunning == schedulerState[core_]) {
+#if !defined(CONFIG_TICKS_64BIT_ENABLE)
+
+      /* If the total runtime on a task has overflowed, reset the total
+       * runtime for all tasks to their last runtime. With 64-bit ticks the
+       * total runtime cannot overflow in practice so there is no need. */
+      if(true == FLAG_OVERFLOW) {
+        __RunTimeReset__();
       }
-    } else {
-      ASSERT;
+
+#endif /* if !defined(CONFIG_TICKS_64BIT_ENABLE) */
+
+
+    /* Read the system ticks once for the whole pass. */
+    now = __PortGetSysTicks__();
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+      __UtilizationAdvance__(now);
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+      /* Tasks given a counting or bitwise notification since the last pass
+       * are only on the signalled list, so move them to the pending list
+       * first. */
+      if(NOTNULLPTR(notifySignalled)) {
+        __NotificationSignalledDrain__();
+      }
+
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+
+
+    /* Waiting tasks with a waiting notification are kept on the pending list
+     * so they can be run without looking at any other task. A task run from
+     * here may give another task a notification or change the state of any
+     * task so the next task to run is kept in the scheduler lists where
+     * __StateListUnlink__() can move it along if it leaves the pending
+     * list. */
+    cursor = slist[core_].pending.head;
+
+    while(NOTNULLPTR(cursor)) {
+      slist[core_].pendingNext = cursor->stateNext;
+      __TaskRun__(cursor);
+      cursor = slist[core_].pendingNext;
     }
 
-#endif /* if defined(CONFIG_TASK_WD_TIMER_ENABLE) */
-  RET_RETURN;
+    slist[core_].pendingNext = null;
+
+
+    /* Waiting tasks with a task timer are kept in the timer heap in the order
+     * their task timers will elapse, so once the task at the top of the timer
+     * heap has not elapsed, none of the others have either. */
+    while((zero < slist[core_].timer.length) && ((now - slist[core_].timer.tasks[zero]->timerStartTime) > slist[core_].timer.tasks[zero]->timerPeriod)) {
+      cursor = slist[core_].timer.tasks[zero];
+
+#if defined(CONFIG_TASK_EDF_ENABLE)
+
+        /* Move the task to the deadline heap so every task whose task timer
+         * has elapsed can be run in order of deadline below. If the deadline
+         * heap could not be grown, just run the task now. */
+        if(OK(__TaskHeapPush__(&slist[core_].deadline, cursor))) {
+          __TaskHeapRemove__(&slist[core_].timer, cursor);
+        } else {
+          __TimerTaskRun__(cursor, now);
+        }
+
+#else  /* if defined(CONFIG_TASK_EDF_ENABLE) */
+        __TimerTaskRun__(cursor, now);
+#endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+    }
+
+#if defined(CONFIG_TASK_EDF_ENABLE)
+
+      /* Running a task puts it back in the timer heap. */
+      while(zero < slist[core_].deadline.length) {
+        cursor = slist[core_].deadline.tasks[zero];
+        __TaskHeapRemove__(&slist[core_].deadline, cursor);
+        __TimerTaskRun__(cursor, now);
+      }
+
+#endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+
+
+    /* Each priority level has its own ready heap and the bits in
+     * readyLevels say which of them have a task in the running state. The
+     * task with the least runtime in the highest of those priority levels is
+     * at the top of its ready heap so there is nothing to search for. */
+    if(zero != slist[core_].readyLevels) {
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+        /* With more than one thread, hand out a task from the top of the
+         * ready heap to each thread. Being a heap, the tasks with the least
+         * runtime are near the top. */
+        level = __ReadyHeapHighest__(core_);
+
+        for(index = zero; (index < slist[core_].ready[level].length) && (index < schedulerThreads); index++) {
+          __TaskRun__(slist[core_].ready[level].tasks[index]);
+        }
+
+#else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+        __TaskRun__(slist[core_].ready[__ReadyHeapHighest__(core_)].tasks[zero]);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+      /* If no task is in the running state and no waiting task has a
+       * notification, there is nothing to do until a task timer elapses so
+       * the scheduler is idle. */
+    } else if(NULLPTR(slist[core_].pending.head) && NULLPTR(notifySignalled)) {
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+        /* Tasks handed out to the other threads during the pass may change
+         * what there is to do so only go idle if none were run. */
+        if(zero == __TaskRunWait__()) {
+          __SchedulerIdle__(core_);
+        }
+
+#else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+        __SchedulerIdle__(core_);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    }
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+      /* Every task handed out during the pass has to have been run before
+       * the next pass and before deleted tasks can be freed. */
+      __TaskRunWait__();
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+    /* Nothing in the scheduler is using a task any more by the end of a
+     * pass so tasks deleted during the pass can be freed. */
+    if(NOTNULLPTR(slist[core_].deleted)) {
+      __TaskDeletedFree__(core_);
+    }
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+      /* Give the other cores a turn at the kernel lock between passes. */
+      if(0x1u < schedulerCores) {
+        __PortCoreYield__();
+      }
+
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  }
+
+  return;
 }
 
 
+Return_t xTaskStartSchedulerThreads(const Base_t threads_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    if((zero < threads_) && (CONFIG_SCHEDULER_THREADS_MAXIMUM >= threads_) && (false == FLAG_RUNNING)) {
+      /* With one thread there is nothing for the executor to do. */
+      if((0x1u == threads_) || OK(__PortExecutorStart__(threads_, __TaskExecuteThread__))) {
+        schedulerThreads = threads_;
+
+        if(OK(xTaskStartScheduler())) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+
+        if(0x1u < threads_) {
+          __PortExecutorStop__();
+        }
+
+        schedulerThreads = 0x1u;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskStartSchedulerCores(const Base_t cores_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    Base_t core = zero;
+
+
+    if((zero < cores_) && (CONFIG_SCHEDULER_CORES >= cores_) && (false == FLAG_RUNNING) && (NOTNULLPTR(tlist))) {
+      /* The other cores start out in the same state as the first. */
+      for(core = 1; core < cores_; core++) {
+        schedulerState[core] = schedulerState[zero];
+      }
+
+      FLAG_RUNNING = true;
+      schedulerCores = cores_;
+
+      if((0x1u == cores_) || OK(__PortCoreStart__(cores_, __SchedulerCoreThread__))) {
+        __SchedulerRun__(zero);
+        RET_OK;
+      } else {
+        ASSERT;
+
+
+        /* Stop the cores whose threads were started. */
+        for(core = zero; core < cores_; core++) {
+          schedulerState[core] = SchedulerStateSuspended;
+          __PortCoreNotify__(core);
+        }
+      }
+
+      if(0x1u < cores_) {
+        __PortCoreStop__();
+      }
+
+      schedulerCores = 0x1u;
+      FLAG_RUNNING = false;
+
+
+      /* Tasks deleted from the cores that were not run are freed now. */
+      for(core = zero; core < CONFIG_SCHEDULER_CORES; core++) {
+        __TaskDeletedFree__(core);
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+
+  /* Runs a task handed out by __TaskRun__() on whichever thread took it. */
+  static void __TaskExecuteThread__(volatile Addr_t *task_) {
+    Task_t *task = null;
+
+
+    task = (Task_t *) task_;
+    __PortKernelLock__();
+    __TaskExecute__(task);
+    task->dispatched = false;
+
+
+    /* Now that the task has been run, finish the release __TimerTaskRun__()
+     * left to this thread. */
+    if(true == task->released) {
+      task->released = false;
+      __TimerTaskRelease__(task, task->releaseTime);
+    }
+
+    __PortKernelUnlock__(ReturnOK);
+
+    return;
+  }
+
+
+  /* Runs a core's scheduler instance on the thread created for it. */
+  static void __SchedulerCoreThread__(const Base_t core_) {
+    __PortKernelLock__();
+    __SchedulerRun__(core_);
+    __PortKernelUnlock__(ReturnOK);
+
+    return;
+  }
+
+
+  /* Waits for the tasks handed out during the pass to be run, helping to run
+   * them in the meantime, and returns how many there were. */
+  static Word_t __TaskRunWait__(void) {
+    Word_t ran = zero;
+
+
+    if(0x1u < schedulerThreads) {
+      ran = __PortExecutorWait__();
+    }
+
+    return(ran);
+  }
+
+
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+#if !defined(CONFIG_TICKS_64BIT_ENABLE)
+
+
+  static void __RunTimeReset__(void) {
+    Base_t core = zero;
+    Base_t level = zero;
+    Base_t index = zero;
+    Task_t *cursor = null;
+
+
+    cursor = tlist->head;
+
+    /* Go through all of the tasks and set their total runtime to their last
+     * runtime. */
+    while(NOTNULLPTR(cursor)) {
+      cursor->totalRunTime = cursor->lastRunTime;
+      cursor = cursor->next;
+    }
+
+
+    /* Every key in the ready heaps just changed so rebuild them from the
+     * bottom up. */
+    for(core = zero; core < CONFIG_SCHEDULER_CORES; core++) {
+      for(level = zero; level < CONFIG_TASK_PRIORITY_LEVELS; level++) {
+        for(index = slist[core].ready[level].length / 2; zero < index; index--) {
+          __TaskHeapSiftDown__(&slist[core].ready[level], index - 1);
+        }
+      }
+    }
+
+    FLAG_OVERFLOW = false;
+
+    return;
+  }
+
+
+#endif /* if !defined(CONFIG_TICKS_64BIT_ENABLE) */
+
+
+static void __TaskRun__(Task_t *task_) {
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    /* A task handed out to a thread is not handed out again until it has been
+     * run so it is never run by two threads at once. If the thread's run queue
+     * is full, just run the task here. */
+    if((0x1u < schedulerThreads) && (false == task_->dispatched)) {
+  #if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+        /* Stackful tasks are always run by the thread that started the
+         * scheduler since that is where their stacks are switched. */
+        if(NOTNULLPTR(task_->context)) {
+          __TaskExecute__(task_);
+        } else if(OK(__PortExecutorSubmit__(task_))) {
+          task_->dispatched = true;
+        } else {
+          __TaskExecute__(task_);
+        }
+
+  #else  /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+        if(OK(__PortExecutorSubmit__(task_))) {
+          task_->dispatched = true;
+        } else {
+          __TaskExecute__(task_);
+        }
+
+  #endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+    } else if(0x1u == schedulerThreads) {
+      __TaskExecute__(task_);
+    }
+
+#else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    __TaskExecute__(task_);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+  return;
+}
+
+
+static void __TaskExecute__(Task_t *task_) {
+  Ticks_t start = zero;
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    Word_t depth = zero;
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+#if !defined(CONFIG_TICKS_64BIT_ENABLE)
+    Ticks_t prev = zero;
+
+
+    /* Store the previous total runtime to detect for overflow later. */
+    prev = task_->totalRunTime;
+#endif /* if !defined(CONFIG_TICKS_64BIT_ENABLE) */
+
+
+  /* Capture the start time of the task in ticks. */
+  start = __PortGetSysTicks__();
+
+#if defined(CONFIG_TRACE_ENABLE)
+
+    /* A waiting task is only run when it has a notification, what it awaits
+     * may have happened or its task timer has elapsed, so record which one
+     * woke it. A task handed out to a thread may have been given a
+     * notification since its task timer elapsed so go by why it was handed
+     * out. */
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      if(true == task_->released) {
+        __TraceRecord__(task_, TraceEventWakePeriod, start);
+      } else
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    if((TaskStateWaiting == task_->state) && (true == __NotificationPending__(task_))) {
+      __TraceRecord__(task_, TraceEventWakeNotification, start);
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+      } else if((TaskStateWaiting == task_->state) && (AWAIT_READY == task_->awaitKind)) {
+        __TraceRecord__(task_, TraceEventWakeAwait, start);
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+    } else if(TaskStateWaiting == task_->state) {
+      __TraceRecord__(task_, TraceEventWakePeriod, start);
+    }
+
+    __TraceRecord__(task_, TraceEventDispatchStart, start);
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+
+    /* A waiting task is only run when it has a notification, what it awaits
+     * may have happened or its task timer has elapsed, so record how long it
+     * has been since that happened. An await records when it may have
+     * happened in the notification time. */
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      if(true == task_->released) {
+        __TaskHistogramRecord__(task_, TaskHistogramWakeLatency, start - task_->timerStartTime - task_->timerPeriod);
+      } else
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    if(TaskStateWaiting == task_->state) {
+      if(true == __NotificationPending__(task_)) {
+        __TaskHistogramRecord__(task_, TaskHistogramWakeLatency, start - task_->notificationTime);
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+        } else if(AWAIT_READY == task_->awaitKind) {
+          __TaskHistogramRecord__(task_, TaskHistogramWakeLatency, start - task_->notificationTime);
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+      } else {
+        __TaskHistogramRecord__(task_, TaskHistogramWakeLatency, start - task_->timerStartTime - task_->timerPeriod);
+      }
+    }
+
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    /* Let go of the kernel lock while the task runs so tasks on the other
+     * threads can make syscalls. */
+    depth = __PortKernelRelease__();
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+    /* A stackful task carries on from wherever it was on its own stack and
+     * comes back here once it blocks or its main function returns. */
+    if(NOTNULLPTR(task_->context)) {
+      stackfulTask = task_;
+      __PortContextEnter__(task_->context);
+      stackfulTask = null;
+    } else {
+      /* Call the task main function through it's callback. */
+      (*task_->callback)(task_, task_->taskParameter);
+    }
+
+#else  /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+    /* Call the task main function through it's callback. */
+    (*task_->callback)(task_, task_->taskParameter);
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    __PortKernelReacquire__(depth);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+  /* Capture the task runtime by subtracting the start time from the end time.
+   */
+  task_->lastRunTime = __PortGetSysTicks__() - start;
+
+#if defined(CONFIG_TRACE_ENABLE)
+    __TraceRecord__(task_, TraceEventDispatchEnd, start + task_->lastRunTime);
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+
+
+  /* Add the last runtime to the total runtime. */
+  task_->totalRunTime += task_->lastRunTime;
+  lastBusy[TASK_CORE(task_)] = start + task_->lastRunTime;
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+
+    /* Move the window up to when the task returned so the runtime is counted
+     * in the slot it ended in. */
+    __UtilizationAdvance__(start + task_->lastRunTime);
+    task_->utilization[utilizationSlot] += task_->lastRunTime;
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+    __TaskHistogramRecord__(task_, TaskHistogramRunTime, task_->lastRunTime);
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+
+#if defined(CONFIG_TASK_WD_TIMER_ENABLE)
+
+    /* If the task WD timer feature is enabled, if the WD timer period is
+     * greater than zero *AND*
+     *  the last runtime exceeded the WD timer period, then suspend the task. */
+    if((zero < task_->wdTimerPeriod) && (task_->lastRunTime > task_->wdTimerPeriod)) {
+      __TaskStateSet__(task_, TaskStateSuspended);
+#if defined(CONFIG_TRACE_ENABLE)
+        __TraceRecord__(task_, TraceEventWDSuspend, start + task_->lastRunTime);
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+    }
+
+#endif /* if defined(CONFIG_TASK_WD_TIMER_ENABLE) */
+
+  /* The task's runtime changed so, if it is in the ready heap, move it to
+   * where it now belongs. */
+  if(TaskStateRunning == task_->state) {
+    __TaskHeapUpdate__(&slist[TASK_CORE(task_)].ready[TASK_PRIORITY(task_)], task_);
+  }
+
+#if !defined(CONFIG_TICKS_64BIT_ENABLE)
+
+    /* Detect overflow of total runtime. If an overflow occurs, then set the
+     * overflow flag to true. */
+    if(task_->totalRunTime < prev) {
+      FLAG_OVERFLOW = true;
+    }
+
+#endif /* if !defined(CONFIG_TICKS_64BIT_ENABLE) */
+
+  return;
+}
+
+
+static void __TimerTaskRun__(Task_t *task_, const Ticks_t now_) {
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    /* Remember why and when the task was released for when it is run, which
+     * may be after the pass has moved on if it is handed out to a thread. */
+    task_->released = true;
+    task_->releaseTime = now_;
+    __TaskRun__(task_);
+
+
+    /* A task handed out to a thread has not been run yet so leave its release
+     * to __TaskExecuteThread__(). Until then it must not stay at the top of
+     * the timer heap or the pass would find its task timer elapsed again. */
+    if(true == task_->dispatched) {
+      if(__TaskHeapContains__(&slist[TASK_CORE(task_)].timer, task_)) {
+        __TaskHeapRemove__(&slist[TASK_CORE(task_)].timer, task_);
+      }
+    } else {
+      task_->released = false;
+      __TimerTaskRelease__(task_, now_);
+    }
+
+#else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    __TaskRun__(task_);
+    __TimerTaskRelease__(task_, now_);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+  return;
+}
+
+
+static void __TimerTaskRelease__(Task_t *task_, const Ticks_t now_) {
+  Ticks_t start = zero;
+  Ticks_t period = zero;
+  Ticks_t behind = zero;
+
+
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+    Ticks_t ended = zero;
+    Ticks_t jitter = zero;
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+
+
+  /* The task has been run but its task timer has not been restarted so it is
+   * still the one that elapsed. */
+  start = task_->timerStartTime;
+  period = task_->timerPeriod;
+
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+    ended = __PortGetSysTicks__();
+
+
+    /* The release jitter is how long after its task timer elapsed the task
+     * actually got to run. */
+    jitter = (Ticks_t) (ended - task_->lastRunTime - start) - period;
+    task_->releases++;
+    task_->totalReleaseJitter += jitter;
+
+    if(jitter > task_->maximumReleaseJitter) {
+      task_->maximumReleaseJitter = jitter;
+    }
+
+
+    /* The deadline of the task was the end of the task timer period
+     * following the one that elapsed. */
+    if(((Ticks_t) (ended - start) - period) > period) {
+      task_->deadlineMisses++;
+    }
+
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+
+  if(TaskReleasePolicyRelative == task_->releasePolicy) {
+    task_->timerStartTime = now_;
+  } else {
+    /* Start the next task timer period where the one that just elapsed ended,
+     * not when the task was run, so the task does not drift. */
+    task_->timerStartTime = start + period;
+    behind = now_ - task_->timerStartTime;
+
+
+    /* If the next task timer period has already elapsed too, the task has
+     * fallen more than a period behind. The scheduler will run it again right
+     * away to catch up unless its release policy is to skip the periods it
+     * missed. */
+    if((behind > period) && (TaskReleasePolicySkip == task_->releasePolicy)) {
+      task_->timerStartTime += (behind / period) * period;
+    }
+
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+
+      /* Skipping counts every period that was skipped as an overrun. */
+      if((behind > period) && (TaskReleasePolicySkip == task_->releasePolicy)) {
+        task_->overruns += behind / period;
+      } else if(behind > period) {
+        task_->overruns++;
+      }
+
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+  }
+
+  __TimerHeapSync__(task_);
+
+  return;
+}
+
+
+Return_t xTaskResumeAll(void) {
+  SYSCALL_DEFINE;
+
+  /* Each core's scheduler instance is resumed and suspended from that core.
+   * The caller of xTaskStartScheduler() is core zero. */
+  if(NOTNULLPTR(tlist)) {
+    schedulerState[__SchedulerCore__()] = SchedulerStateRunning;
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskSuspendAll(void) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(tlist)) {
+    schedulerState[__SchedulerCore__()] = SchedulerStateSuspended;
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetSchedulerState(SchedulerState_t *state_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(tlist)) {
+    *state_ = schedulerState[__SchedulerCore__()];
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskSetIdleHook(void (*hook_)(void)) {
+  SYSCALL_DEFINE;
+
+
+  /* A null hook is allowed, it removes the idle hook. */
+  idleHook = hook_;
+  RET_OK;
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetIdleTime(Ticks_t *ticks_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(ticks_)) {
+    *ticks_ = idleTime[__SchedulerCore__()];
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetCoreIdleTime(const Base_t core_, Ticks_t *ticks_) {
+  SYSCALL_DEFINE;
+
+  if((CONFIG_SCHEDULER_CORES > core_) && NOTNULLPTR(ticks_)) {
+    *ticks_ = idleTime[core_];
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetUtilization(const Task_t *task_, HalfWord_t *utilization_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(utilization_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        __UtilizationAdvance__(__PortGetSysTicks__());
+        *utilization_ = __UtilizationOf__(task_->utilization);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+    /* Sliding window utilization is not being kept so there is nothing to
+     * get. */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetIdleUtilization(HalfWord_t *utilization_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+
+    if(NOTNULLPTR(utilization_)) {
+      __UtilizationAdvance__(__PortGetSysTicks__());
+      *utilization_ = __UtilizationOf__(utilizationIdle[__SchedulerCore__()]);
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskGetAwaitPoint(const Task_t *task_, HalfWord_t *point_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(point_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        *point_ = task_->awaitPoint;
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskSetAwaitPoint(Task_t *task_, const HalfWord_t point_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        task_->awaitPoint = point_;
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskAwaitNotification(Task_t *task_, Base_t *res_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(res_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        /* A waiting task with a notification is already on the pending list so
+         * there is nothing more to wait on. */
+        if(OK(__TaskAwait__(task_, __NotificationWaiting__(task_), AWAIT_NONE, null, zero, res_))) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskAwaitPeriod(Task_t *task_, const Ticks_t ticks_, Base_t *res_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+    Ticks_t now = zero;
+
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(res_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        now = __PortGetSysTicks__();
+
+        if((zero == ticks_) || ((AWAIT_PERIOD == task_->awaitKind) && ((Ticks_t) (now - task_->awaitStart) >= ticks_))) {
+          /* The task timer was only borrowed for the await so stop it. */
+          task_->timerPeriod = zero;
+
+          if(OK(__TaskAwait__(task_, true, AWAIT_NONE, null, zero, res_))) {
+            RET_OK;
+          } else {
+            ASSERT;
+          }
+        } else {
+          /* If the task was run for some other reason before the period was
+           * up, leave the task timer alone so the period is not started over.
+           */
+          if(AWAIT_PERIOD != task_->awaitKind) {
+            task_->awaitStart = now;
+            task_->timerStartTime = now;
+            task_->timerPeriod = ticks_;
+          }
+
+          if(OK(__TaskAwait__(task_, false, AWAIT_PERIOD, null, zero, res_))) {
+            RET_OK;
+          } else {
+            ASSERT;
+          }
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskAwaitQueue(Task_t *task_, const Queue_t *queue_, Base_t *res_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(res_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_)) && OK(__KernelObjectCheck__(queue_))) {
+        if(OK(__TaskAwait__(task_, zero < queue_->length, AWAIT_OBJECT, queue_, 0x1u, res_))) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTaskAwaitStream(Task_t *task_, const StreamBuffer_t *stream_, const HalfWord_t bytes_, Base_t *res_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+    if(NOTNULLPTR(task_) && (zero < bytes_) && (CONFIG_STREAM_BUFFER_BYTES >= bytes_) && NOTNULLPTR(res_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_)) && OK(__KernelObjectCheck__(stream_))) {
+        if(OK(__TaskAwait__(task_, bytes_ <= stream_->length, AWAIT_OBJECT, stream_, bytes_, res_))) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+
+  /* Called by xQueueSend() and xStreamSend() with how many messages or bytes
+   * the message queue or stream buffer now holds. Every task awaiting enough
+   * of them is moved to the pending list so the scheduler runs it on its next
+   * pass. */
+  void __TaskAwaitWake__(const volatile Addr_t *object_, const HalfWord_t count_) {
+    Base_t core = zero;
+    Task_t *cursor = null;
+    Task_t *next = null;
+
+
+    /* The tasks awaiting the message queue or stream buffer may be on any
+     * core. */
+    for(core = zero; core < CONFIG_SCHEDULER_CORES; core++) {
+      cursor = slist[core].awaiting.head;
+
+      while(NOTNULLPTR(cursor)) {
+        next = cursor->stateNext;
+
+        if((object_ == cursor->awaitObject) && (cursor->awaitBytes <= count_)) {
+          __TaskAwaitSet__(cursor, AWAIT_READY, null, zero);
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+            cursor->notificationTime = __PortGetSysTicks__();
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+        }
+
+        cursor = next;
+      }
+    }
+
+    return;
+  }
+
+
+  /* Called by xQueueDelete() and xStreamDelete() so no task is left awaiting
+   * a message queue or stream buffer that no longer exists. Those tasks stay
+   * in the waiting state. */
+  void __TaskAwaitDrop__(const volatile Addr_t *object_) {
+    Base_t core = zero;
+    Task_t *cursor = null;
+    Task_t *next = null;
+
+
+    for(core = zero; core < CONFIG_SCHEDULER_CORES; core++) {
+      cursor = slist[core].awaiting.head;
+
+      while(NOTNULLPTR(cursor)) {
+        next = cursor->stateNext;
+
+        if(object_ == cursor->awaitObject) {
+          __TaskAwaitSet__(cursor, AWAIT_NONE, null, zero);
+        }
+
+        cursor = next;
+      }
+    }
+
+    return;
+  }
+
+
+  static Return_t __TaskAwait__(Task_t *task_, const Base_t ready_, const Base_t kind_, const volatile Addr_t *object_, const HalfWord_t bytes_, Base_t
+    *res_) {
+    RET_DEFINE;
+
+    if(false == ready_) {
+      /* Awaiting always leaves the task in the waiting state so the scheduler
+       * only runs it once what it is awaiting may have happened. */
+      if(OK(__TaskStateSet__(task_, TaskStateWaiting))) {
+        __TaskAwaitSet__(task_, kind_, object_, bytes_);
+
+        if(OK(__TimerHeapSync__(task_))) {
+          *res_ = false;
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      __TaskAwaitSet__(task_, AWAIT_NONE, null, zero);
+
+      if(OK(__TimerHeapSync__(task_))) {
+        *res_ = true;
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    }
+
+    RET_RETURN;
+  }
+
+
+  static void __TaskAwaitSet__(Task_t *task_, const Base_t kind_, const volatile Addr_t *object_, const HalfWord_t bytes_) {
+    /* What a waiting task is awaiting decides which list it is on, so take the
+     * task off of its list before the change and put it back on the right one
+     * after. */
+    __StateListUnlink__(task_);
+    task_->awaitKind = kind_;
+    task_->awaitObject = object_;
+    task_->awaitBytes = bytes_;
+    __StateListLink__(task_);
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+
+Return_t xTaskDelay(const Ticks_t ticks_) {
+  SYSCALL_DEFINE;
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+    if(OK(__TaskBlock__(null, ticks_))) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+
+#else  /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+    ASSERT;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+
+  /* Blocks the stackful task that is running until the message queue has a
+   * message or, if there is no message queue, until the ticks have passed.
+   * While it is blocked the task awaits in the waiting state and its stack is
+   * left as it is. Once it is done, the task is put back in the state it was
+   * in and its task timer is put back the way it was. */
+  Return_t __TaskBlock__(const Queue_t *queue_, const Ticks_t ticks_) {
+    RET_DEFINE;
+
+
+    Task_t *task = null;
+    TaskState_t state = TaskStateSuspended;
+    Ticks_t period = zero;
+    Ticks_t startTime = zero;
+    Base_t ready = false;
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      Word_t depth = zero;
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+    if(NOTNULLPTR(stackfulTask) && NOTNULLPTR(tlist)) {
+      task = stackfulTask;
+      state = task->state;
+      period = task->timerPeriod;
+      startTime = task->timerStartTime;
+
+      /* Each time the scheduler runs the task again, check whether what it is
+       * blocked on has happened and, if not, go back to the scheduler. */
+      while(OK(__TaskBlockAwait__(task, queue_, ticks_, &ready)) && (false == ready)) {
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+          /* The kernel lock is held per thread, not per stack, so let go of it
+           * while the scheduler has the thread. */
+          depth = __PortKernelRelease__();
+          __PortContextLeave__(task->context);
+          __PortKernelReacquire__(depth);
+#else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+          __PortContextLeave__(task->context);
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+      }
+
+      if(false != ready) {
+        task->timerPeriod = period;
+        task->timerStartTime = startTime;
+
+        if(OK(__TaskStateSet__(task, state)) && OK(__TimerHeapSync__(task))) {
+          RET_OK;
+        } else {
+          ASSERT;
+        }
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+  static Return_t __TaskBlockAwait__(Task_t *task_, const Queue_t *queue_, const Ticks_t ticks_, Base_t *res_) {
+    RET_DEFINE;
+
+    if(NOTNULLPTR(queue_)) {
+      if(OK(xTaskAwaitQueue(task_, queue_, res_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else if(OK(xTaskAwaitPeriod(task_, ticks_, res_))) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+  /* Every stackful task starts here on its own stack. The task's main function
+   * is called the same way the scheduler calls a normal task's main function,
+   * so when it returns the task goes back to the scheduler and the main
+   * function is called again the next time the task is run. */
+  static void __TaskStackfulEntry__(void) {
+    for(;;) {
+      (*stackfulTask->callback)(stackfulTask, stackfulTask->taskParameter);
+      __PortContextLeave__(stackfulTask->context);
+    }
+  }
+
+
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+
+static void __SchedulerIdle__(const Base_t core_) {
+  Ticks_t now = zero;
+  Ticks_t idle = zero;
+
+
+#if defined(CONFIG_TICKLESS_IDLE_ENABLE)
+    Ticks_t elapsed = zero;
+    Ticks_t sleep = CONFIG_TICKLESS_IDLE_MAXIMUM_TICKS;
+#endif /* if defined(CONFIG_TICKLESS_IDLE_ENABLE) */
+
+
+  if(NOTNULLPTR(idleHook)) {
+    (*idleHook)();
+  }
+
+#if defined(CONFIG_TICKLESS_IDLE_ENABLE)
+
+    /* The idle hook may have suspended the scheduler or given a task a
+     * notification, in which case don't sleep. */
+    if((SchedulerStateRunning == schedulerState[core_]) && NULLPTR(slist[core_].pending.head) && NULLPTR(notifySignalled) && (zero ==
+      slist[core_].readyLevels)) {
+      /* Sleep until the task timer at the top of the timer heap elapses. A
+       * task timer has elapsed once more than its period has passed, hence the
+       * extra tick. */
+      if(zero < slist[core_].timer.length) {
+        elapsed = __PortGetSysTicks__() - slist[core_].timer.tasks[zero]->timerStartTime;
+
+        if(elapsed > slist[core_].timer.tasks[zero]->timerPeriod) {
+          sleep = zero;
+        } else if((slist[core_].timer.tasks[zero]->timerPeriod - elapsed) < sleep) {
+          sleep = slist[core_].timer.tasks[zero]->timerPeriod - elapsed + 1;
+        }
+      }
+
+  #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+        /* With more than one core, the core waits below instead so it does
+         * not sleep with the kernel lock. */
+        if((zero < sleep) && (0x1u == schedulerCores)) {
+          __PortIdle__(sleep);
+        }
+
+  #else  /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+        if(zero < sleep) {
+          __PortIdle__(sleep);
+        }
+
+  #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+    }
+
+#endif /* if defined(CONFIG_TICKLESS_IDLE_ENABLE) */
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    /* An idle core lets go of the kernel lock and waits for another core to
+     * give one of its tasks something to do, or for a little while so its task
+     * timers are still looked at. */
+    if((0x1u < schedulerCores) && (SchedulerStateRunning == schedulerState[core_]) && NULLPTR(slist[core_].pending.head) && NULLPTR(notifySignalled)
+      && (zero == slist[core_].readyLevels)) {
+      __PortCoreWait__(core_);
+    }
+
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+  /* Everything since the core last ran a task, or last counted idle time,
+   * counts as idle time. Measuring from the start of the scheduler pass
+   * instead would miss the passes that found nothing to do, which take less
+   * than a tick unless the scheduler actually sleeps. */
+  now = __PortGetSysTicks__();
+  idle = now - lastBusy[core_];
+  lastBusy[core_] = now;
+  idleTime[core_] += idle;
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+    __UtilizationAdvance__(now);
+    utilizationIdle[core_][utilizationSlot] += idle;
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+  return;
+}
+
+
+/* Returns the core whose scheduler instance the caller is running on, which
+ * is core zero for anything not run by xTaskStartSchedulerCores(). */
+static Base_t __SchedulerCore__(void) {
+  Base_t core = zero;
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    core = __PortCoreGet__();
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+  return(core);
+}
+
+
+static void __SchedulerNotify__(const Task_t *task_) {
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+    /* A task on another core may now have something to do so wake that core
+     * in case it is idle. The core's own tasks are looked at on its next pass
+     * anyway. */
+    if((0x1u < schedulerCores) && (TASK_CORE(task_) != __SchedulerCore__())) {
+      __PortCoreNotify__(TASK_CORE(task_));
+    }
+
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+  return;
+}
+
+
+/* Gives every heap in the scheduler lists of every core its slot. This is the
+ * only place the scheduler lists are set up. */
+static void __SchedulerListsInit__(void) {
+  Base_t core = zero;
+  Base_t level = zero;
+
+
+  for(core = zero; core < CONFIG_SCHEDULER_CORES; core++) {
+    for(level = zero; level < CONFIG_TASK_PRIORITY_LEVELS; level++) {
+      slist[core].ready[level].slot = TASK_HEAP_READY;
+    }
+
+    slist[core].timer.slot = TASK_HEAP_TIMER;
+
+#if defined(CONFIG_TASK_EDF_ENABLE)
+      slist[core].deadline.slot = TASK_HEAP_DEADLINE;
+#endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+
+#if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+
+      for(level = zero; level < CONFIG_TASK_PRIORITY_LEVELS; level++) {
+        slist[core].ready[level].tasks = heapStatic[core][level];
+        slist[core].ready[level].capacity = CONFIG_TASK_STATIC_HEAPS_TASKS;
+      }
+
+      slist[core].timer.tasks = heapStatic[core][CONFIG_TASK_PRIORITY_LEVELS];
+      slist[core].timer.capacity = CONFIG_TASK_STATIC_HEAPS_TASKS;
+
+  #if defined(CONFIG_TASK_EDF_ENABLE)
+        slist[core].deadline.tasks = heapStatic[core][CONFIG_TASK_PRIORITY_LEVELS + 0x1u];
+        slist[core].deadline.capacity = CONFIG_TASK_STATIC_HEAPS_TASKS;
+  #endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+#endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+  }
+
+  return;
+}
+
+
+Return_t xTaskGetWDPeriod(const Task_t *task_, Ticks_t *period_) {
+  SYSCALL_DEFINE;
+#if defined(CONFIG_TASK_WD_TIMER_ENABLE)
+
+    if(NOTNULLPTR(task_) && NOTNULLPTR(period_) && NOTNULLPTR(tlist)) {
+      if(OK(__TaskListFindTask__(task_))) {
+        *period_ = task_->wdTimerPeriod;
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+
+#endif /* if defined(CONFIG_TASK_WD_TIMER_ENABLE) */
+  SYSCALL_RETURN;
+}
+
+
+static Return_t __TaskStateSet__(Task_t *task_, const TaskState_t state_) {
+  RET_DEFINE;
+
+  if(NOTNULLPTR(task_)) {
+    if(state_ == task_->state) {
+      RET_OK;
+    } else if(TaskStateRunning == state_) {
+      /* Tasks in the running state live in the ready heap for their priority
+       * level. Push the task first because it may need to grow the ready heap
+       * and, if that fails, the task should be left where it was. */
+      if(OK(__ReadyHeapPush__(task_))) {
+        __StateListUnlink__(task_);
+        task_->state = state_;
+        __TimerHeapSync__(task_);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      if(TaskStateRunning == task_->state) {
+        __ReadyHeapRemove__(task_);
+      } else {
+        __StateListUnlink__(task_);
+      }
+
+      task_->state = state_;
+      __StateListLink__(task_);
+
+      if(OK(__TimerHeapSync__(task_))) {
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    }
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+static Return_t __TimerHeapSync__(Task_t *task_) {
+  RET_DEFINE;
+
+  /* Only tasks in the waiting state with a task timer belong in the timer
+   * heap. Make it so and, if the task stays in the timer heap, move it to
+   * where its release time now puts it. A task in the deadline heap is on its
+   * way to being run by the scheduler, which will put it back in the timer
+   * heap, so it only needs to be moved to where its deadline now puts it. */
+  if((TaskStateWaiting == task_->state) && (zero < task_->timerPeriod)) {
+#if defined(CONFIG_TASK_EDF_ENABLE)
+
+      if(__TaskHeapContains__(&slist[TASK_CORE(task_)].deadline, task_)) {
+        __TaskHeapUpdate__(&slist[TASK_CORE(task_)].deadline, task_);
+        RET_OK;
+      } else if(__TaskHeapContains__(&slist[TASK_CORE(task_)].timer, task_)) {
+        __TaskHeapUpdate__(&slist[TASK_CORE(task_)].timer, task_);
+        __SchedulerNotify__(task_);
+        RET_OK;
+      } else if(OK(__TaskHeapPush__(&slist[TASK_CORE(task_)].timer, task_))) {
+        __SchedulerNotify__(task_);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#else  /* if defined(CONFIG_TASK_EDF_ENABLE) */
+
+      if(__TaskHeapContains__(&slist[TASK_CORE(task_)].timer, task_)) {
+        __TaskHeapUpdate__(&slist[TASK_CORE(task_)].timer, task_);
+        __SchedulerNotify__(task_);
+        RET_OK;
+      } else if(OK(__TaskHeapPush__(&slist[TASK_CORE(task_)].timer, task_))) {
+        __SchedulerNotify__(task_);
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+
+#endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+  } else {
+    if(__TaskHeapContains__(&slist[TASK_CORE(task_)].timer, task_)) {
+      __TaskHeapRemove__(&slist[TASK_CORE(task_)].timer, task_);
+    }
+
+#if defined(CONFIG_TASK_EDF_ENABLE)
+
+      if(__TaskHeapContains__(&slist[TASK_CORE(task_)].deadline, task_)) {
+        __TaskHeapRemove__(&slist[TASK_CORE(task_)].deadline, task_);
+      }
+
+#endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+
+    RET_OK;
+  }
+
+  RET_RETURN;
+}
+
+
+static Return_t __TaskHeapPush__(TaskHeap_t *heap_, Task_t *task_) {
+  RET_DEFINE;
+
+  /* NOTE: There is a __TaskHeapGrow__() call buried in this if() statement.
+   */
+  if((heap_->length < heap_->capacity) || OK(__TaskHeapGrow__(heap_))) {
+    task_->heapIndex[heap_->slot] = heap_->length;
+    heap_->tasks[heap_->length] = task_;
+    heap_->length++;
+    __TaskHeapSiftUp__(heap_, task_->heapIndex[heap_->slot]);
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+static Return_t __TaskHeapGrow__(TaskHeap_t *heap_) {
+  RET_DEFINE;
+
+#if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+
+    /* The static heaps already hold as many tasks as may be created so they
+     * are never grown. */
+    ASSERT;
+#else  /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+    Task_t **tasks = null;
+    Base_t capacity = zero;
+
+
+    /* Tasks may be created at any time, including by other tasks while the
+     * scheduler is running, so the heap doubles in size each time it is full.
+     * That way it is only reallocated a handful of times however many tasks
+     * there are. A Base_t holds no more than 255 tasks so past half of that it
+     * goes straight to the most there can be. */
+    if(zero == heap_->capacity) {
+      capacity = TASK_HEAP_MINIMUM_CAPACITY;
+    } else if(0x80u > heap_->capacity) {
+      capacity = heap_->capacity * 0x2u;
+    } else {
+      capacity = (Base_t) -1;
+    }
+
+    if((heap_->capacity < capacity) && OK(__KernelAllocateMemory__((volatile Addr_t **) &tasks, capacity * sizeof(Task_t *)))) {
+      if(NOTNULLPTR(heap_->tasks)) {
+        if(OK(__memcpy__(tasks, heap_->tasks, heap_->length * sizeof(Task_t *)))) {
+          __KernelFreeMemory__(heap_->tasks);
+          heap_->tasks = tasks;
+          heap_->capacity = capacity;
+          RET_OK;
+        } else {
+          ASSERT;
+
+
+          /* Free kernel memory because __memcpy__() failed. */
+          __KernelFreeMemory__(tasks);
+        }
+      } else {
+        heap_->tasks = tasks;
+        heap_->capacity = capacity;
+        RET_OK;
+      }
+    } else {
+      ASSERT;
+    }
+
+#endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+
+  RET_RETURN;
+}
+
+
+static void __TaskHeapRemove__(TaskHeap_t *heap_, Task_t *task_) {
+  Base_t index = zero;
+
+
+  index = task_->heapIndex[heap_->slot];
+  heap_->length--;
+
+
+  /* Fill the hole with the last task in the heap and move it to where it
+   * belongs. */
+  if(index < heap_->length) {
+    heap_->tasks[index] = heap_->tasks[heap_->length];
+    heap_->tasks[index]->heapIndex[heap_->slot] = index;
+    __TaskHeapUpdate__(heap_, heap_->tasks[index]);
+  }
+
+  heap_->tasks[heap_->length] = null;
+
+  return;
+}
+
+
+static void __TaskHeapUpdate__(TaskHeap_t *heap_, Task_t *task_) {
+  __TaskHeapSiftUp__(heap_, task_->heapIndex[heap_->slot]);
+  __TaskHeapSiftDown__(heap_, task_->heapIndex[heap_->slot]);
+
+  return;
+}
+
+
+static Base_t __TaskHeapContains__(const TaskHeap_t *heap_, const Task_t *task_) {
+  return((task_->heapIndex[heap_->slot] < heap_->length) && (heap_->tasks[task_->heapIndex[heap_->slot]] == task_));
+}
+
+
+static void __TaskHeapSiftUp__(TaskHeap_t *heap_, Base_t index_) {
+  Task_t *task = null;
+  Base_t parent = zero;
+
+
+  task = heap_->tasks[index_];
+
+  while(zero < index_) {
+    parent = (index_ - 1) / 2;
+
+    if(!__TaskHeapLess__(heap_, task, heap_->tasks[parent])) {
+      break;
+    }
+
+    heap_->tasks[index_] = heap_->tasks[parent];
+    heap_->tasks[index_]->heapIndex[heap_->slot] = index_;
+    index_ = parent;
+  }
+
+  heap_->tasks[index_] = task;
+  task->heapIndex[heap_->slot] = index_;
+
+  return;
+}
+
+
+static void __TaskHeapSiftDown__(TaskHeap_t *heap_, Base_t index_) {
+  Task_t *task = null;
+  HalfWord_t child = zero;
+
+
+  task = heap_->tasks[index_];
+
+  while(((HalfWord_t) (index_ * 2) + 1) < heap_->length) {
+    child = (HalfWord_t) (index_ * 2) + 1;
+
+
+    /* Pick the lesser of the two children. */
+    if(((child + 1) < heap_->length) && __TaskHeapLess__(heap_, heap_->tasks[child + 1], heap_->tasks[child])) {
+      child++;
+    }
+
+    if(!__TaskHeapLess__(heap_, heap_->tasks[child], task)) {
+      break;
+    }
+
+    heap_->tasks[index_] = heap_->tasks[child];
+    heap_->tasks[index_]->heapIndex[heap_->slot] = index_;
+    index_ = (Base_t) child;
+  }
+
+  heap_->tasks[index_] = task;
+  task->heapIndex[heap_->slot] = index_;
+
+  return;
+}
+
+
+static Base_t __TaskHeapLess__(const TaskHeap_t *heap_, const Task_t *a_, const Task_t *b_) {
+  Ticks_t a = zero;
+  Ticks_t b = zero;
+
+
+  if(TASK_HEAP_READY != heap_->slot) {
+    /* The timer heap is ordered by release time and the deadline heap by
+     * deadline, which is one task timer period after the release time. The
+     * difference is used instead of comparing the times directly so the order
+     * still holds when the system ticks wrap around. */
+    a = a_->timerStartTime + a_->timerPeriod;
+    b = b_->timerStartTime + b_->timerPeriod;
+
+    if(TASK_HEAP_DEADLINE == heap_->slot) {
+      a += a_->timerPeriod;
+      b += b_->timerPeriod;
+    }
+
+    if(a != b) {
+      return(((Ticks_t) (a - b)) > (((Ticks_t) -1) >> 1));
+    }
+  } else {
+    /* The ready heap is ordered by total runtime. */
+    if(a_->totalRunTime != b_->totalRunTime) {
+      return(a_->totalRunTime < b_->totalRunTime);
+    }
+  }
+
+
+  /* Ties go to the task that was created first, the same as when the
+   * scheduler used to walk the task list in order. */
+  return(a_->id < b_->id);
+}
+
+
+static Return_t __ReadyHeapPush__(Task_t *task_) {
+  RET_DEFINE;
+
+  if(OK(__TaskHeapPush__(&slist[TASK_CORE(task_)].ready[TASK_PRIORITY(task_)], task_))) {
+    slist[TASK_CORE(task_)].readyLevels |= ((Word_t) 1u << TASK_PRIORITY(task_));
+    __SchedulerNotify__(task_);
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+static void __ReadyHeapRemove__(Task_t *task_) {
+  __TaskHeapRemove__(&slist[TASK_CORE(task_)].ready[TASK_PRIORITY(task_)], task_);
+
+  if(zero == slist[TASK_CORE(task_)].ready[TASK_PRIORITY(task_)].length) {
+    slist[TASK_CORE(task_)].readyLevels &= ~((Word_t) 1u << TASK_PRIORITY(task_));
+  }
+
+  return;
+}
+
+
+static Base_t __ReadyHeapHighest__(const Base_t core_) {
+  static const Byte_t highest[0x10u] = {
+    0x0u, 0x0u, 0x1u, 0x1u, 0x2u, 0x2u, 0x2u, 0x2u, 0x3u, 0x3u, 0x3u, 0x3u, 0x3u, 0x3u, 0x3u, 0x3u
+  };
+  Base_t shift = zero;
+
+
+  /* Find the most significant bit set in readyLevels a nibble at a time,
+   * starting from the nibble that holds the highest priority level. The number
+   * of steps depends only on CONFIG_TASK_PRIORITY_LEVELS and not on the number
+   * of tasks. The caller makes sure at least one bit is set. */
+  shift = (Base_t) (((CONFIG_TASK_PRIORITY_LEVELS - 1) / 4) * 4);
+
+  while((zero < shift) && (zero == ((slist[core_].readyLevels >> shift) & 0xFu))) {
+    shift -= 4;
+  }
+
+  return((Base_t) (shift + highest[(slist[core_].readyLevels >> shift) & 0xFu]));
+}
+
+
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+
+
+  static void __TaskHistogramRecord__(Task_t *task_, const TaskHistogramId_t id_, Ticks_t ticks_) {
+    Base_t bucket = zero;
+
+
+    if(ticks_ > task_->histogramMaximum[id_]) {
+      task_->histogramMaximum[id_] = ticks_;
+    }
+
+
+    /* The bucket is the position of the most significant bit of the time
+     * which is found with a binary search so it takes the same few steps no
+     * matter how long the time was. Anything too long for the last bucket goes
+     * in the last bucket. */
+  #if defined(CONFIG_TICKS_64BIT_ENABLE)
+
+      if(zero != (ticks_ >> 0x20u)) {
+        ticks_ = (Ticks_t) 1u << (TASK_HISTOGRAM_BUCKETS - 1);
+      }
+
+  #endif /* if defined(CONFIG_TICKS_64BIT_ENABLE) */
+
+    if(zero != (ticks_ >> 0x10u)) {
+      ticks_ >>= 0x10u;
+      bucket += 0x10u;
+    }
+
+    if(zero != (ticks_ >> 0x8u)) {
+      ticks_ >>= 0x8u;
+      bucket += 0x8u;
+    }
+
+    if(zero != (ticks_ >> 0x4u)) {
+      ticks_ >>= 0x4u;
+      bucket += 0x4u;
+    }
+
+    if(zero != (ticks_ >> 0x2u)) {
+      ticks_ >>= 0x2u;
+      bucket += 0x2u;
+    }
+
+    if(zero != (ticks_ >> 0x1u)) {
+      bucket += 0x1u;
+    }
+
+    task_->histogram[id_][bucket]++;
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+
+
+#if defined(CONFIG_TRACE_ENABLE)
+
+
+  static void __TraceRecord__(const Task_t *task_, const TraceEventType_t event_, const Ticks_t time_) {
+    /* The trace buffer is a ring so, once it is full, the oldest event is
+     * overwritten. */
+    trace[traceNext].time = time_;
+    trace[traceNext].id = task_->id;
+    trace[traceNext].event = (Base_t) event_;
+    traceNext = (HalfWord_t) ((traceNext + 1u) % CONFIG_TRACE_BUFFER_EVENTS);
+
+    if(CONFIG_TRACE_BUFFER_EVENTS > traceLength) {
+      traceLength++;
+    }
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+
+
+  static void __UtilizationAdvance__(const Ticks_t now_) {
+    Ticks_t slots = zero;
+    Base_t core = zero;
+    Task_t *cursor = null;
+
+
+    if(false == utilizationStarted) {
+      utilizationSlotStart = now_;
+      utilizationStarted = true;
+    } else if((now_ - utilizationSlotStart) >= CONFIG_TASK_UTILIZATION_SLOT_TICKS) {
+      slots = (now_ - utilizationSlotStart) / CONFIG_TASK_UTILIZATION_SLOT_TICKS;
+      utilizationSlotStart += slots * CONFIG_TASK_UTILIZATION_SLOT_TICKS;
+
+
+      /* Once a whole window has gone by every slot is stale so there is no
+       * need to go around more than once. */
+      if(CONFIG_TASK_UTILIZATION_SLOTS < slots) {
+        slots = CONFIG_TASK_UTILIZATION_SLOTS;
+      }
+
+      while(zero < slots) {
+        utilizationSlot = (Base_t) ((utilizationSlot + 1u) % CONFIG_TASK_UTILIZATION_SLOTS);
+        for(core = zero; core < CONFIG_SCHEDULER_CORES; core++) {
+          utilizationIdle[core][utilizationSlot] = zero;
+        }
+
+        if(NOTNULLPTR(tlist)) {
+          cursor = tlist->head;
+
+          while(NOTNULLPTR(cursor)) {
+            cursor->utilization[utilizationSlot] = zero;
+            cursor = cursor->next;
+          }
+        }
+
+        if((CONFIG_TASK_UTILIZATION_SLOTS - 1u) > utilizationSlots) {
+          utilizationSlots++;
+        }
+
+        slots--;
+      }
+    }
+
+    utilizationNow = now_;
+
+    return;
+  }
+
+
+  static HalfWord_t __UtilizationOf__(const Ticks_t *slots_) {
+    Base_t slot = zero;
+    Ticks_t used = zero;
+    Ticks_t window = zero;
+    HalfWord_t ret = zero;
+
+
+    /* The window is every slot that has gone by plus however much of the
+     * current slot has. */
+    window = ((Ticks_t) utilizationSlots * CONFIG_TASK_UTILIZATION_SLOT_TICKS) + (utilizationNow - utilizationSlotStart);
+
+    for(slot = zero; slot < CONFIG_TASK_UTILIZATION_SLOTS; slot++) {
+      used += slots_[slot];
+    }
+
+    if(zero < window) {
+      /* Scale the window down instead of the time used up when multiplying
+       * by 1000 could overflow a tick. */
+      if(window <= (((Ticks_t) ~((Ticks_t) zero)) / 1000u)) {
+        used = (used * 1000u) / window;
+      } else {
+        used = used / (window / 1000u);
+      }
+
+      if(1000u < used) {
+        used = 1000u;
+      }
+
+      ret = (HalfWord_t) used;
+    }
+
+    return(ret);
+  }
+
+
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+
+#if defined(CONFIG_TASK_INDEX_ENABLE)
+  static Base_t __TaskNameHash__(const Byte_t *name_) {
+    Base_t i = zero;
+    Word_t hash = 0x811C9DC5u; /* FNV-1a offset basis */
+
+
+    for(i = zero; i < CONFIG_TASK_NAME_BYTES; i++) {
+      hash ^= (Word_t) name_[i];
+      hash *= 0x1000193u; /* FNV-1a prime */
+    }
+
+
+    /* Fold the hash down to a byte so every bit of it counts. */
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+
+    return((Base_t) hash);
+  }
+
+
+  static Base_t __TaskHandleHash__(const Task_t *task_) {
+    Word_t hash = zero;
+
+
+    /* Task objects are block aligned so drop the bits that are always the same
+     * and use Fibonacci hashing to spread the rest, because tasks created one
+     * after the other are usually the same number of blocks apart. */
+    hash = ((Word_t) (((Size_t) task_) / CONFIG_MEMORY_REGION_BLOCK_SIZE)) * 0x9E3779B1u;
+
+    return((Base_t) (hash >> 24));
+  }
+
+
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+
+static void __TaskIndexLink__(Task_t *task_) {
+#if defined(CONFIG_TASK_INDEX_ENABLE)
+    task_->nameHash = __TaskNameHash__(task_->name);
+    task_->nameNext = tlist->names[task_->nameHash % CONFIG_TASK_INDEX_BUCKETS];
+    tlist->names[task_->nameHash % CONFIG_TASK_INDEX_BUCKETS] = task_;
+    task_->idNext = tlist->ids[task_->id % CONFIG_TASK_INDEX_BUCKETS];
+    tlist->ids[task_->id % CONFIG_TASK_INDEX_BUCKETS] = task_;
+    task_->handleNext = tlist->handles[__TaskHandleHash__(task_) % CONFIG_TASK_INDEX_BUCKETS];
+    tlist->handles[__TaskHandleHash__(task_) % CONFIG_TASK_INDEX_BUCKETS] = task_;
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+  return;
+}
+
+
+static void __TaskIndexUnlink__(const Task_t *task_) {
+#if defined(CONFIG_TASK_INDEX_ENABLE)
+    Task_t **link = null;
+
+
+    /* Walk the links of each bucket rather than the tasks so the task can be
+     * unlinked whether it is first in its bucket or not. */
+    link = &tlist->names[task_->nameHash % CONFIG_TASK_INDEX_BUCKETS];
+
+    while(NOTNULLPTR(*link) && (*link != task_)) {
+      link = &(*link)->nameNext;
+    }
+
+    if(NOTNULLPTR(*link)) {
+      *link = task_->nameNext;
+    }
+
+    link = &tlist->ids[task_->id % CONFIG_TASK_INDEX_BUCKETS];
+
+    while(NOTNULLPTR(*link) && (*link != task_)) {
+      link = &(*link)->idNext;
+    }
+
+    if(NOTNULLPTR(*link)) {
+      *link = task_->idNext;
+    }
+
+    link = &tlist->handles[__TaskHandleHash__(task_) % CONFIG_TASK_INDEX_BUCKETS];
+
+    while(NOTNULLPTR(*link) && (*link != task_)) {
+      link = &(*link)->handleNext;
+    }
+
+    if(NOTNULLPTR(*link)) {
+      *link = task_->handleNext;
+    }
+
+#endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+  return;
+}
+
+
+static void __TaskDeletedFree__(const Base_t core_) {
+  Task_t *cursor = null;
+
+
+  while(NOTNULLPTR(slist[core_].deleted)) {
+    cursor = slist[core_].deleted;
+    slist[core_].deleted = cursor->next;
+    __TaskFree__(cursor);
+  }
+
+  return;
+}
+
+
+static Return_t __TaskFree__(Task_t *task_) {
+  RET_DEFINE;
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+
+    /* A stackful task's stack goes with it, whatever was left on the stack
+     * when it was deleted. */
+    if(NOTNULLPTR(task_->context)) {
+      __KernelFreeMemory__(task_->context);
+      task_->context = null;
+    }
+
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+  if(OK(__KernelObjectFree__(task_))) {
+    RET_OK;
+  } else {
+    ASSERT;
+  }
+
+  RET_RETURN;
+}
+
+
+static void __StateListLink__(Task_t *task_) {
+  TaskStateList_t *list = null;
+
+
+  task_->statePrev = null;
+  task_->stateNext = null;
+  list = __StateListFor__(task_);
+
+
+  /* Tasks are added to the end of their list so the pending list is run in
+   * the order the notifications were given. */
+  if(NOTNULLPTR(list)) {
+    task_->statePrev = list->tail;
+
+    if(NOTNULLPTR(list->tail)) {
+      list->tail->stateNext = task_;
+    } else {
+      list->head = task_;
+    }
+
+    list->tail = task_;
+
+    if(list == &slist[TASK_CORE(task_)].pending) {
+      __SchedulerNotify__(task_);
+    }
+  }
+
+  return;
+}
+
+
+static void __StateListUnlink__(Task_t *task_) {
+  TaskStateList_t *list = null;
+
+
+  list = __StateListFor__(task_);
+
+  if(NOTNULLPTR(list)) {
+    /* If the scheduler was about to run this task next, point it at the task
+     * after it instead. */
+    if(slist[TASK_CORE(task_)].pendingNext == task_) {
+      slist[TASK_CORE(task_)].pendingNext = task_->stateNext;
+    }
+
+    if(list->head == task_) {
+      list->head = task_->stateNext;
+    }
+
+    if(list->tail == task_) {
+      list->tail = task_->statePrev;
+    }
+
+    if(NOTNULLPTR(task_->statePrev)) {
+      task_->statePrev->stateNext = task_->stateNext;
+    }
+
+    if(NOTNULLPTR(task_->stateNext)) {
+      task_->stateNext->statePrev = task_->statePrev;
+    }
+  }
+
+  task_->statePrev = null;
+  task_->stateNext = null;
+
+  return;
+}
+
+
+static TaskStateList_t *__StateListFor__(const Task_t *task_) {
+  /* Tasks in the running state are in the ready heap, not on a list. A
+   * counting or bitwise notification only counts once the scheduler has moved
+   * the task off of the signalled list, so the list a task is on never changes
+   * under it from an interrupt. */
+  if((TaskStateWaiting == task_->state) && (true == __NotificationPending__(task_))) {
+    return(&slist[TASK_CORE(task_)].pending);
+  }
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+
+    /* A waiting task whose await may have been satisfied is run like one with
+     * a notification. One still awaiting a message queue or stream buffer is
+     * kept where xQueueSend() and xStreamSend() can find it. */
+    if((TaskStateWaiting == task_->state) && (AWAIT_READY == task_->awaitKind)) {
+      return(&slist[TASK_CORE(task_)].pending);
+    } else if((TaskStateWaiting == task_->state) && (AWAIT_OBJECT == task_->awaitKind)) {
+      return(&slist[TASK_CORE(task_)].awaiting);
+    }
+
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+  if(TaskStateWaiting == task_->state) {
+    return(&slist[TASK_CORE(task_)].waiting);
+  } else if(TaskStateSuspended == task_->state) {
+    return(&slist[TASK_CORE(task_)].suspended);
+  }
+
+  return(null);
+}
+
+
+static void __NotificationBytesSet__(Task_t *task_, const Base_t bytes_) {
+  /* Giving or taking a notification moves a waiting task between the waiting
+   * and pending lists, so take the task off of its list before the change and
+   * put it back on the right one after. */
+  __StateListUnlink__(task_);
+  task_->notificationBytes = bytes_;
+  __StateListLink__(task_);
+
+  return;
+}
+
+
+static Base_t __NotificationWaiting__(const Task_t *task_) {
+  Base_t waiting = false;
+
+
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+    CRITICAL_DEFINE;
+
+
+    ENTER_CRITICAL(CriticalSiteTaskNotify);
+
+    if((zero < task_->notificationBytes) || (zero != task_->notificationCount) || (zero != task_->notificationBits)) {
+      waiting = true;
+    }
+
+    EXIT_CRITICAL(CriticalSiteTaskNotify);
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+
+    if(zero < task_->notificationBytes) {
+      waiting = true;
+    }
+
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+
+  return(waiting);
+}
+
+
+/* Whether the scheduler should run a waiting task for its notification. A
+ * counting or bitwise notification only counts once the scheduler has moved
+ * the task off of the signalled list. */
+static Base_t __NotificationPending__(const Task_t *task_) {
+  Base_t pending = false;
+
+
+  if(zero < task_->notificationBytes) {
+    pending = true;
+  }
+
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+    if(true == task_->eventsPending) {
+      pending = true;
+    }
+
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+
+  return(pending);
+}
+
+
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+
+
+  /* Gives a counting and/or bitwise notification. This only touches the task's
+   * count and bits and the signalled list, with interrupts disabled, so it is
+   * all the FromISR() syscalls do. The task is moved to the pending list by the
+   * scheduler on its next pass. */
+  static Return_t __NotificationEventsGive__(Task_t *task_, const Word_t count_, const Word_t bits_) {
+    RET_DEFINE;
+    CRITICAL_DEFINE;
+
+
+    Base_t given = false;
+
+
+    ENTER_CRITICAL(CriticalSiteTaskNotify);
+
+
+    /* The count saturates rather than wraps so a burst is never lost. */
+    if(((Word_t) ~task_->notificationCount) >= count_) {
+      task_->notificationCount += count_;
+      task_->notificationBits |= bits_;
+
+      if(false == task_->eventsSignalled) {
+        task_->eventsSignalled = true;
+        task_->signalNext = notifySignalled;
+        notifySignalled = task_;
+      }
+
+      given = true;
+    }
+
+    EXIT_CRITICAL(CriticalSiteTaskNotify);
+
+    if(true == given) {
+      RET_OK;
+    } else {
+      ASSERT;
+    }
+
+    RET_RETURN;
+  }
+
+
+  /* Takes the count and/or bits, whichever is asked for, and clears them. */
+  static void __NotificationEventsTake__(Task_t *task_, Word_t *count_, Word_t *bits_) {
+    CRITICAL_DEFINE;
+    Base_t pending = false;
+
+
+    ENTER_CRITICAL(CriticalSiteTaskNotify);
+
+    if(NOTNULLPTR(count_)) {
+      *count_ = task_->notificationCount;
+      task_->notificationCount = zero;
+    }
+
+    if(NOTNULLPTR(bits_)) {
+      *bits_ = task_->notificationBits;
+      task_->notificationBits = zero;
+    }
+
+    if((zero != task_->notificationCount) || (zero != task_->notificationBits)) {
+      pending = true;
+    }
+
+    EXIT_CRITICAL(CriticalSiteTaskNotify);
+    __NotificationEventsSet__(task_, pending);
+
+    return;
+  }
+
+
+  static void __NotificationEventsSet__(Task_t *task_, const Base_t pending_) {
+    /* Like __NotificationBytesSet__(), move the task between the waiting and
+     * pending lists around the change. */
+    if(pending_ != task_->eventsPending) {
+      __StateListUnlink__(task_);
+      task_->eventsPending = pending_;
+      __StateListLink__(task_);
+
+  #if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+
+        /* The system ticks cannot be read from an interrupt so the wake latency
+         * of a counting or bitwise notification is measured from when the
+         * scheduler picks it up. */
+        if(true == pending_) {
+          task_->notificationTime = __PortGetSysTicks__();
+        }
+
+  #endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+    }
+
+    return;
+  }
+
+
+  static void __NotificationSignalledDrain__(void) {
+    CRITICAL_DEFINE;
+    Task_t *cursor = null;
+    Task_t *next = null;
+    Base_t pending = false;
+
+
+    ENTER_CRITICAL(CriticalSiteTaskNotify);
+    cursor = notifySignalled;
+    notifySignalled = null;
+    EXIT_CRITICAL(CriticalSiteTaskNotify);
+
+    while(NOTNULLPTR(cursor)) {
+      /* Once the task is off of the signalled list, a notification given from
+       * an interrupt pushes it back on so it is looked at again next pass. */
+      ENTER_CRITICAL(CriticalSiteTaskNotify);
+      next = cursor->signalNext;
+      cursor->signalNext = null;
+      cursor->eventsSignalled = false;
+      pending = false;
+
+      if((zero != cursor->notificationCount) || (zero != cursor->notificationBits)) {
+        pending = true;
+      }
+
+      EXIT_CRITICAL(CriticalSiteTaskNotify);
+      __NotificationEventsSet__(cursor, pending);
+      cursor = next;
+    }
+
+    return;
+  }
+
+
+  static void __NotificationSignalledRemove__(const Task_t *task_) {
+    CRITICAL_DEFINE;
+    Task_t *cursor = null;
+    Task_t *previous = null;
+
+
+    ENTER_CRITICAL(CriticalSiteTaskNotify);
+
+    if(true == task_->eventsSignalled) {
+      cursor = notifySignalled;
+
+      while(NOTNULLPTR(cursor) && (cursor != task_)) {
+        previous = cursor;
+        cursor = cursor->signalNext;
+      }
+
+      if(NOTNULLPTR(cursor)) {
+        if(NOTNULLPTR(previous)) {
+          previous->signalNext = cursor->signalNext;
+        } else {
+          notifySignalled = cursor->signalNext;
+        }
+      }
+    }
+
+    EXIT_CRITICAL(CriticalSiteTaskNotify);
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+
+
 #if defined(POSIX_ARCH_OTHER)
 
 
   /* For unit testing only! */
   void __TaskStateClear__(void) {
     tlist = null;
+    __memset__(slist, 0x0, sizeof(slist));
+    idleHook = null;
+    __memset__(idleTime, 0x0, sizeof(idleTime));
+    __memset__(lastBusy, 0x0, sizeof(lastBusy));
+    notifySignalled = null;
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+      stackfulTask = null;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+#if defined(CONFIG_TRACE_ENABLE)
+      traceNext = zero;
+      traceLength = zero;
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+      __memset__(utilizationIdle, 0x0, sizeof(utilizationIdle));
+      utilizationSlotStart = zero;
+      utilizationNow = zero;
+      utilizationSlot = zero;
+      utilizationSlots = zero;
+      utilizationStarted = false;
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+    __SchedulerListsInit__();
 
     return;
   }
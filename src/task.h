@@ -32,11 +32,20 @@
     extern "C" {
   #endif /* ifdef __cplusplus */
   Return_t xTaskCreate(Task_t **task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_);
+  Return_t xTaskCreateWithPriority(Task_t **task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_, const
+    Base_t priority_);
+  Return_t xTaskCreateStatic(Task_t **task_, Byte_t *storage_, const Size_t bytes_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_),
+    TaskParm_t *taskParameter_);
+  Return_t xTaskCreateStackful(Task_t **task_, const Byte_t *name_, void (*callback_)(Task_t *task_, TaskParm_t *parm_), TaskParm_t *taskParameter_, const
+    Size_t bytes_);
   Return_t xTaskDelete(const Task_t *task_);
   Return_t xTaskGetHandleByName(Task_t **task_, const Byte_t *name_);
   Return_t xTaskGetHandleById(Task_t **task_, const Base_t id_);
   Return_t xTaskGetAllRunTimeStats(TaskRunTimeStats_t **stats_, Base_t *tasks_);
   Return_t xTaskGetTaskRunTimeStats(const Task_t *task_, TaskRunTimeStats_t **stats_);
+  Return_t xTaskGetLatencyHistogram(const Task_t *task_, const TaskHistogramId_t id_, TaskHistogram_t **histogram_);
+  Return_t xTaskGetTrace(TraceEvent_t **events_, HalfWord_t *count_);
+  Return_t xTaskClearTrace(void);
   Return_t xTaskGetNumberOfTasks(Base_t *tasks_);
   Return_t xTaskGetTaskInfo(const Task_t *task_, TaskInfo_t **info_);
   Return_t xTaskGetAllTaskInfo(TaskInfo_t **info_, Base_t *tasks_);
@@ -47,19 +56,53 @@
   Return_t xTaskNotificationIsWaiting(const Task_t *task_, Base_t *res_);
   Return_t xTaskNotifyGive(Task_t *task_, const Base_t bytes_, const Byte_t *value_);
   Return_t xTaskNotifyTake(Task_t *task_, TaskNotification_t **notification_);
+  Return_t xTaskNotifyGiveCount(Task_t *task_);
+  Return_t xTaskNotifyTakeCount(Task_t *task_, Word_t *count_);
+  Return_t xTaskNotifyGiveBits(Task_t *task_, const Word_t bits_);
+  Return_t xTaskNotifyTakeBits(Task_t *task_, Word_t *bits_);
+  Return_t xTaskNotifyGiveCountFromISR(Task_t *task_);
+  Return_t xTaskNotifyGiveBitsFromISR(Task_t *task_, const Word_t bits_);
   Return_t xTaskResume(Task_t *task_);
   Return_t xTaskSuspend(Task_t *task_);
   Return_t xTaskWait(Task_t *task_);
   Return_t xTaskChangePeriod(Task_t *task_, const Ticks_t period_);
   Return_t xTaskChangeWDPeriod(Task_t *task_, const Ticks_t period_);
   Return_t xTaskGetPeriod(const Task_t *task_, Ticks_t *period_);
+  Return_t xTaskChangeReleasePolicy(Task_t *task_, const TaskReleasePolicy_t policy_);
+  Return_t xTaskGetReleasePolicy(const Task_t *task_, TaskReleasePolicy_t *policy_);
+  Return_t xTaskChangePriority(Task_t *task_, const Base_t priority_);
+  Return_t xTaskGetPriority(const Task_t *task_, Base_t *priority_);
+  Return_t xTaskSetAffinity(Task_t *task_, const Base_t core_);
+  Return_t xTaskGetAffinity(const Task_t *task_, Base_t *core_);
   Return_t xTaskResetTimer(Task_t *task_);
   Return_t xTaskStartScheduler(void);
+  Return_t xTaskStartSchedulerThreads(const Base_t threads_);
+  Return_t xTaskStartSchedulerCores(const Base_t cores_);
   Return_t xTaskResumeAll(void);
   Return_t xTaskSuspendAll(void);
   Return_t xTaskGetSchedulerState(SchedulerState_t *state_);
   Return_t xTaskGetWDPeriod(const Task_t *task_, Ticks_t *period_);
+  Return_t xTaskSetIdleHook(void (*hook_)(void));
+  Return_t xTaskGetIdleTime(Ticks_t *ticks_);
+  Return_t xTaskGetCoreIdleTime(const Base_t core_, Ticks_t *ticks_);
+  Return_t xTaskGetUtilization(const Task_t *task_, HalfWord_t *utilization_);
+  Return_t xTaskGetIdleUtilization(HalfWord_t *utilization_);
+  Return_t xTaskGetAwaitPoint(const Task_t *task_, HalfWord_t *point_);
+  Return_t xTaskSetAwaitPoint(Task_t *task_, const HalfWord_t point_);
+  Return_t xTaskAwaitNotification(Task_t *task_, Base_t *res_);
+  Return_t xTaskAwaitPeriod(Task_t *task_, const Ticks_t ticks_, Base_t *res_);
+  Return_t xTaskAwaitQueue(Task_t *task_, const Queue_t *queue_, Base_t *res_);
+  Return_t xTaskAwaitStream(Task_t *task_, const StreamBuffer_t *stream_, const HalfWord_t bytes_, Base_t *res_);
+  Return_t xTaskDelay(const Ticks_t ticks_);
 
+  #if defined(CONFIG_TASK_AWAIT_ENABLE)
+    void __TaskAwaitWake__(const volatile Addr_t *object_, const HalfWord_t count_);
+    void __TaskAwaitDrop__(const volatile Addr_t *object_);
+  #endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+  #if defined(CONFIG_TASK_STACKFUL_ENABLE)
+    Return_t __TaskBlock__(const Queue_t *queue_, const Ticks_t ticks_);
+  #endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
 
   #if defined(POSIX_ARCH_OTHER)
     void __TaskStateClear__(void);
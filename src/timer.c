@@ -18,7 +18,7 @@
 
 
 Return_t xTimerCreate(Timer_t **timer_, const Ticks_t period_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_)) {
     if(OK(__KernelAllocateMemory__((volatile Addr_t **) timer_, sizeof(Task_t)))) {
@@ -37,16 +37,40 @@ Return_t xTimerCreate(Timer_t **timer_, const Ticks_t period_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
+}
+
+
+Return_t xTimerCreateStatic(Timer_t **timer_, Byte_t *storage_, const Size_t bytes_, const Ticks_t period_) {
+  SYSCALL_DEFINE;
+
+  if(NOTNULLPTR(timer_)) {
+    if(OK(__StaticAllocateMemory__((volatile Addr_t **) timer_, storage_, bytes_, sizeof(Timer_t)))) {
+      if(NOTNULLPTR(*timer_)) {
+        (*timer_)->state = TimerStateSuspended;
+        (*timer_)->timerPeriod = period_;
+        (*timer_)->timerStartTime = __PortGetSysTicks__();
+        RET_OK;
+      } else {
+        ASSERT;
+      }
+    } else {
+      ASSERT;
+    }
+  } else {
+    ASSERT;
+  }
+
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerDelete(const Timer_t *timer_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
-      if(OK(__KernelFreeMemory__(timer_))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
+      if(OK(__KernelObjectFree__(timer_))) {
         RET_OK;
       } else {
         ASSERT;
@@ -58,15 +82,15 @@ Return_t xTimerDelete(const Timer_t *timer_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerChangePeriod(Timer_t *timer_, const Ticks_t period_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
       timer_->timerPeriod = period_;
       RET_OK;
     } else {
@@ -76,15 +100,15 @@ Return_t xTimerChangePeriod(Timer_t *timer_, const Ticks_t period_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerGetPeriod(const Timer_t *timer_, Ticks_t *period_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_) && NOTNULLPTR(period_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
       *period_ = timer_->timerPeriod;
       RET_OK;
     } else {
@@ -94,15 +118,15 @@ Return_t xTimerGetPeriod(const Timer_t *timer_, Ticks_t *period_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerIsTimerActive(const Timer_t *timer_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
       if(TimerStateRunning == timer_->state) {
         *res_ = true;
         RET_OK;
@@ -117,15 +141,15 @@ Return_t xTimerIsTimerActive(const Timer_t *timer_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerHasTimerExpired(const Timer_t *timer_, Base_t *res_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_) && NOTNULLPTR(res_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
       if(TimerStateRunning == timer_->state) {
         if((zero < timer_->timerPeriod) && ((__PortGetSysTicks__() - timer_->timerStartTime) > timer_->timerPeriod)) {
           *res_ = true;
@@ -144,15 +168,15 @@ Return_t xTimerHasTimerExpired(const Timer_t *timer_, Base_t *res_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerReset(Timer_t *timer_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
       timer_->timerStartTime = __PortGetSysTicks__();
       RET_OK;
     } else {
@@ -162,15 +186,15 @@ Return_t xTimerReset(Timer_t *timer_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerStart(Timer_t *timer_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
       if(TimerStateSuspended == timer_->state) {
         timer_->state = TimerStateRunning;
         timer_->timerStartTime = __PortGetSysTicks__();
@@ -185,15 +209,15 @@ Return_t xTimerStart(Timer_t *timer_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
 
 
 Return_t xTimerStop(Timer_t *timer_) {
-  RET_DEFINE;
+  SYSCALL_DEFINE;
 
   if(NOTNULLPTR(timer_)) {
-    if(OK(__MemoryRegionCheckKernel__(timer_, MEMORY_REGION_CHECK_OPTION_W_ADDR))) {
+    if(OK(__KernelObjectCheck__(timer_))) {
       if(TimerStateRunning == timer_->state) {
         timer_->state = TimerStateSuspended;
         timer_->timerStartTime = __PortGetSysTicks__();
@@ -208,5 +232,5 @@ Return_t xTimerStop(Timer_t *timer_) {
     ASSERT;
   }
 
-  RET_RETURN;
+  SYSCALL_RETURN;
 }
\ No newline at end of file
@@ -32,6 +32,7 @@
     extern "C" {
   #endif /* ifdef __cplusplus */
   Return_t xTimerCreate(Timer_t **timer_, const Ticks_t period_);
+  Return_t xTimerCreateStatic(Timer_t **timer_, Byte_t *storage_, const Size_t bytes_, const Ticks_t period_);
   Return_t xTimerDelete(const Timer_t *timer_);
   Return_t xTimerChangePeriod(Timer_t *timer_, const Ticks_t period_);
   Return_t xTimerGetPeriod(const Timer_t *timer_, Ticks_t *period_);
@@ -36,6 +36,11 @@
     SchedulerStateSuspended,
     SchedulerStateRunning
   } SchedulerState_t;
+  typedef enum TaskReleasePolicy_e {
+    TaskReleasePolicyRelative,
+    TaskReleasePolicyCatchUp,
+    TaskReleasePolicySkip
+  } TaskReleasePolicy_t;
   typedef enum Return_e {
     ReturnOK,
     ReturnError
@@ -53,6 +58,38 @@
     DeviceModeWriteOnly,
     DeviceModeReadWrite
   } DeviceMode_t;
+  typedef enum MemoryRegionId_e {
+    MemoryRegionHeap,
+    MemoryRegionKernel
+  } MemoryRegionId_t;
+  typedef enum CriticalSite_e {
+    CriticalSiteMemAlloc,
+    CriticalSiteMemFree,
+    CriticalSiteBuddyAlloc,
+    CriticalSiteBuddyFree,
+    CriticalSitePortTick,
+    CriticalSiteTaskNotify
+  } CriticalSite_t;
+  typedef enum TaskHistogramId_e {
+    TaskHistogramRunTime,
+    TaskHistogramWakeLatency
+  } TaskHistogramId_t;
+  typedef enum TraceEventType_e {
+    TraceEventDispatchStart,
+    TraceEventDispatchEnd,
+    TraceEventWakePeriod,
+    TraceEventWakeNotification,
+    TraceEventSuspend,
+    TraceEventResume,
+    TraceEventWDSuspend,
+    TraceEventWakeAwait
+  } TraceEventType_t;
+  typedef enum StaticObject_e {
+    StaticObjectTask,
+    StaticObjectQueue,
+    StaticObjectTimer,
+    StaticObjectStream
+  } StaticObject_t;
   typedef VOID_TYPE TaskParm_t;
   typedef UINT8_TYPE Base_t;
   typedef UINT8_TYPE Byte_t;
@@ -60,7 +97,11 @@
   typedef SIZE_TYPE Size_t;
   typedef UINT16_TYPE HalfWord_t;
   typedef UINT32_TYPE Word_t;
-  typedef UINT32_TYPE Ticks_t;
+  #if defined(CONFIG_TICKS_64BIT_ENABLE)
+    typedef UINT64_TYPE Ticks_t;
+  #else  /* if defined(CONFIG_TICKS_64BIT_ENABLE) */
+    typedef UINT32_TYPE Ticks_t;
+  #endif /* if defined(CONFIG_TICKS_64BIT_ENABLE) */
   typedef struct Device_s {
     HalfWord_t uid;
     Byte_t name[CONFIG_DEVICE_NAME_BYTES];
@@ -92,11 +133,37 @@
   typedef struct MemoryRegion_s {
     volatile Byte_t mem[MEMORY_REGION_SIZE_IN_BYTES];
     MemoryEntry_t *start;
+  #if CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_NEXT_FIT
+      MemoryEntry_t *rover;
+  #endif /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+          * MEMORY_PLACEMENT_POLICY_NEXT_FIT */
     HalfWord_t entrySize;
     HalfWord_t allocations;
     HalfWord_t frees;
+    HalfWord_t freeBlocks;
+    HalfWord_t version;
     Word_t minAvailableEver;
   } MemoryRegion_t;
+  #if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+    typedef struct BuddyEntry_s {
+      Word_t magic;
+      struct BuddyEntry_s *next;
+      struct BuddyEntry_s *prev;
+    } BuddyEntry_t;
+    typedef struct BuddyRegion_s {
+      volatile Byte_t mem[BUDDY_REGION_SIZE_IN_BYTES + BUDDY_REGION_ALIGNMENT - 0x1u];
+      Byte_t *base;
+      Byte_t blocks[BUDDY_REGION_SIZE_IN_BLOCKS];
+      BuddyEntry_t *free[BUDDY_REGION_ORDERS];
+      HalfWord_t allocations;
+      HalfWord_t frees;
+      Word_t available;
+      Word_t minAvailableEver;
+    } BuddyRegion_t;
+  #endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+  typedef struct StaticEntry_s {
+    struct StaticEntry_s *next;
+  } StaticEntry_t;
   typedef struct TaskNotification_s {
     Base_t notificationBytes;
     Byte_t notificationValue[CONFIG_NOTIFICATION_VALUE_BYTES];
@@ -104,6 +171,15 @@
   typedef struct Task_s {
     Base_t id;
     Byte_t name[CONFIG_TASK_NAME_BYTES];
+    Base_t heapIndex[TASK_HEAPS];
+
+  #if CONFIG_TASK_PRIORITY_LEVELS > 0x1u
+      Base_t priority;
+  #endif /* if CONFIG_TASK_PRIORITY_LEVELS > 0x1u */
+
+  #if CONFIG_SCHEDULER_CORES > 0x1u
+      Base_t core;
+  #endif /* if CONFIG_SCHEDULER_CORES > 0x1u */
     TaskState_t state;
     TaskParm_t *taskParameter;
 
@@ -119,6 +195,7 @@
     Ticks_t totalRunTime;
     Ticks_t timerPeriod;
     Ticks_t timerStartTime;
+    TaskReleasePolicy_t releasePolicy;
 
 
 
@@ -129,11 +206,69 @@
 
   #endif /* if defined(CONFIG_TASK_WD_TIMER_ENABLE) */
     struct Task_s *next;
+    struct Task_s *stateNext;
+    struct Task_s *statePrev;
+
+  #if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+      Word_t releases;
+      Word_t overruns;
+      Word_t deadlineMisses;
+      Ticks_t maximumReleaseJitter;
+      Ticks_t totalReleaseJitter;
+  #endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+
+  #if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+      volatile Word_t notificationCount;
+      volatile Word_t notificationBits;
+      volatile Base_t eventsSignalled;
+      Base_t eventsPending;
+      struct Task_s *volatile signalNext;
+  #endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+
+  #if defined(CONFIG_TASK_INDEX_ENABLE)
+      struct Task_s *nameNext;
+      struct Task_s *idNext;
+      struct Task_s *handleNext;
+      Base_t nameHash;
+  #endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
+
+  #if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+      Ticks_t notificationTime;
+      Ticks_t histogramMaximum[TASK_HISTOGRAMS];
+      Word_t histogram[TASK_HISTOGRAMS][TASK_HISTOGRAM_BUCKETS];
+  #endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+
+  #if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+      Ticks_t utilization[CONFIG_TASK_UTILIZATION_SLOTS];
+  #endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+
+  #if defined(CONFIG_TASK_AWAIT_ENABLE)
+      HalfWord_t awaitPoint;
+      Base_t awaitKind;
+      HalfWord_t awaitBytes;
+      Ticks_t awaitStart;
+      const volatile Addr_t *awaitObject;
+  #endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+  #if defined(CONFIG_TASK_STACKFUL_ENABLE)
+      volatile Addr_t *context;
+  #endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+  #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+      Ticks_t releaseTime;
+      Base_t dispatched;
+      Base_t released;
+  #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
   } Task_t;
   typedef struct TaskRunTimeStats_s {
     Base_t id;
     Ticks_t lastRunTime;
     Ticks_t totalRunTime;
+    Word_t deadlineMisses;
+    Word_t releases;
+    Word_t overruns;
+    Ticks_t maximumReleaseJitter;
+    Ticks_t totalReleaseJitter;
   } TaskRunTimeStats_t;
   typedef struct MemoryRegionStats_s {
     Word_t largestFreeEntryInBytes;
@@ -144,18 +279,74 @@
     Word_t successfulFrees;
     Word_t minimumEverFreeBytesRemaining;
   } MemoryRegionStats_t;
+  typedef struct MemoryRegionMapEntry_s {
+    HalfWord_t offset;
+    HalfWord_t blocks;
+    Base_t free;
+  } MemoryRegionMapEntry_t;
+  typedef struct CriticalSectionStats_s {
+    Word_t count;
+    Word_t maximum;
+    Word_t histogram[CRITICAL_SECTION_HISTOGRAM_BUCKETS];
+  } CriticalSectionStats_t;
+  typedef struct TaskHistogram_s {
+    Word_t count;
+    Ticks_t maximum;
+    Ticks_t percentile99;
+    Word_t histogram[TASK_HISTOGRAM_BUCKETS];
+  } TaskHistogram_t;
+  typedef struct TraceEvent_s {
+    Ticks_t time;
+    Base_t id;
+    Base_t event;
+  } TraceEvent_t;
   typedef struct TaskInfo_s {
     Base_t id;
     Byte_t name[CONFIG_TASK_NAME_BYTES];
     TaskState_t state;
     Ticks_t lastRunTime;
     Ticks_t totalRunTime;
+    HalfWord_t utilization;
   } TaskInfo_t;
   typedef struct TaskList_s {
     Base_t nextId;
     Base_t length;
     Task_t *head;
+
+  #if defined(CONFIG_TASK_INDEX_ENABLE)
+      Task_t *names[CONFIG_TASK_INDEX_BUCKETS];
+      Task_t *ids[CONFIG_TASK_INDEX_BUCKETS];
+      Task_t *handles[CONFIG_TASK_INDEX_BUCKETS];
+  #endif /* if defined(CONFIG_TASK_INDEX_ENABLE) */
   } TaskList_t;
+  typedef struct TaskHeap_s {
+    Task_t **tasks;
+    Base_t length;
+    Base_t capacity;
+    Base_t slot;
+  } TaskHeap_t;
+  typedef struct TaskStateList_s {
+    Task_t *head;
+    Task_t *tail;
+  } TaskStateList_t;
+  typedef struct SchedulerLists_s {
+    TaskHeap_t ready[CONFIG_TASK_PRIORITY_LEVELS];
+    Word_t readyLevels;
+    TaskHeap_t timer;
+
+  #if defined(CONFIG_TASK_EDF_ENABLE)
+      TaskHeap_t deadline;
+  #endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+    TaskStateList_t waiting;
+    TaskStateList_t pending;
+    TaskStateList_t suspended;
+    Task_t *pendingNext;
+    Task_t *deleted;
+
+  #if defined(CONFIG_TASK_AWAIT_ENABLE)
+      TaskStateList_t awaiting;
+  #endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+  } SchedulerLists_t;
   typedef struct DeviceList_s {
     Base_t length;
     Device_t *head;
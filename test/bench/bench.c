@@ -0,0 +1,63 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file bench.c
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Benchmark sources
+ * @version 0.4.1
+ * @date 2023-03-19
+ * 
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *  
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  
+ * 
+ */
+/*UNCRUSTIFY-ON*/
+#include "bench.h"
+
+
+static Word_t seed = 0x1u;
+
+
+void bench_reset(void) {
+  __MemoryClear__();
+  __SysStateClear__();
+  __TaskStateClear__();
+  __DeviceStateClear__();
+
+  return;
+}
+
+
+void bench_now(bench_time_t *time_) {
+  clock_gettime(CLOCK_MONOTONIC, time_);
+
+  return;
+}
+
+
+Word_t bench_elapsed_ns(const bench_time_t *start_) {
+  bench_time_t now;
+
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return((Word_t) (((now.tv_sec - start_->tv_sec) * 1000000000L) + (now.tv_nsec - start_->tv_nsec)));
+}
+
+
+void bench_srand(const Word_t seed_) {
+  seed = seed_;
+
+  return;
+}
+
+
+Word_t bench_rand(void) {
+  /* A fixed linear congruential generator so every build sees exactly the same
+   * sequence of requests regardless of the host's C library. */
+  seed = (seed * 1103515245u) + 12345u;
+
+  return((seed >> 0x10u) & 0x7FFFu);
+}
@@ -0,0 +1,62 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file bench.h
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Benchmark sources
+ * @version 0.4.1
+ * @date 2023-03-19
+ * 
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *  
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  
+ * 
+ */
+/*UNCRUSTIFY-ON*/
+#ifndef BENCH_H_
+  #define BENCH_H_
+
+  #include "posix.h"
+  #include "config.h"
+  #include "defines.h"
+  #include "types.h"
+  #include "port.h"
+  #include "device.h"
+  #include "mem.h"
+  #include "queue.h"
+  #include "stream.h"
+  #include "sys.h"
+  #include "task.h"
+  #include "timer.h"
+
+  #include <stdint.h>
+  #include <string.h>
+  #include <stdlib.h>
+  #include <stdio.h>
+  #include <time.h>
+
+  #if CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_FIRST_FIT
+    #define BENCH_MEMORY_PLACEMENT_POLICY "first-fit"
+  #elif CONFIG_MEMORY_PLACEMENT_POLICY == MEMORY_PLACEMENT_POLICY_NEXT_FIT
+    #define BENCH_MEMORY_PLACEMENT_POLICY "next-fit"
+  #else  /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+          * MEMORY_PLACEMENT_POLICY_FIRST_FIT */
+    #define BENCH_MEMORY_PLACEMENT_POLICY "best-fit"
+  #endif /* if CONFIG_MEMORY_PLACEMENT_POLICY ==
+          * MEMORY_PLACEMENT_POLICY_FIRST_FIT */
+  typedef struct timespec bench_time_t;
+
+  #ifdef __cplusplus
+    extern "C" {
+  #endif /* ifdef __cplusplus */
+  void bench_reset(void);
+  void bench_now(bench_time_t *time_);
+  Word_t bench_elapsed_ns(const bench_time_t *start_);
+  void bench_srand(const Word_t seed_);
+  Word_t bench_rand(void);
+
+  #ifdef __cplusplus
+    }
+  #endif /* ifdef __cplusplus */
+#endif /* ifndef BENCH_H_ */
@@ -0,0 +1,68 @@
+#!/bin/bash
+
+# @file bench.sh
+# @author Manny Peterson <manny@heliosproj.org>
+# @brief A shell script to build and run the HeliOS benchmarks
+# @version 0.4.1
+# @date 2023-03-19
+# 
+# @copyright
+# HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+#  
+#  SPDX-License-Identifier: GPL-2.0-or-later
+
+# Run from the root of the repository. Each benchmark is built once per
+# configuration because the settings it compares are compile-time options.
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+BIN=$ROOT/test/bin
+CC=${CC:-gcc}
+CFLAGS="-O2 -ansi -pedantic -Wall -Wextra -Wno-unused-parameter -I$ROOT/src -I$ROOT/test/bench -DPOSIX_ARCH_OTHER"
+POLICIES="BEST_FIT FIRST_FIT NEXT_FIT"
+
+mkdir -p $BIN || exit 1
+
+function build {
+	NAME=$1
+	shift
+	$CC $CFLAGS "$@" -o $BIN/$NAME $ROOT/src/*.c $ROOT/test/bench/bench.c $ROOT/test/bench/$BENCH.c || exit 1
+}
+
+BENCH=mem_bench
+RESULTS=""
+for POLICY in $POLICIES
+do
+	build ${BENCH}_${POLICY,,} -DCONFIG_MEMORY_REGION_SIZE_IN_BLOCKS=0x1000u -DCONFIG_MEMORY_PLACEMENT_POLICY=MEMORY_PLACEMENT_POLICY_$POLICY
+	RESULTS+=$($BIN/${BENCH}_${POLICY,,})$'\n'
+done
+
+printf "%-8s %-10s %10s %10s %8s %8s %10s\n" "workload" "policy" "alloc(ns)" "free(ns)" "failed" "frag" "min-free"
+echo -n "$RESULTS" | sort -s -k1,1
+
+# Boot time is compared with and without lazy memory region initialization
+# using 1 MiB memory regions.
+BENCH=boot_bench
+build ${BENCH}_eager -DCONFIG_MEMORY_REGION_SIZE_IN_BLOCKS=0x8000u
+build ${BENCH}_lazy -DCONFIG_MEMORY_REGION_SIZE_IN_BLOCKS=0x8000u -DCONFIG_MEMORY_REGION_LAZY_INIT
+
+echo
+printf "%-6s %10s %12s %12s %14s\n" "init" "region(B)" "cold(ns)" "warm(ns)" "1st-alloc(ns)"
+$BIN/${BENCH}_eager || exit 1
+$BIN/${BENCH}_lazy || exit 1
+
+# The scheduler is run with one thread and then with each thread count up to
+# CONFIG_SCHEDULER_THREADS_MAXIMUM, or THREADS if it is set.
+BENCH=sched_bench
+build ${BENCH} -DCONFIG_MEMORY_REGION_SIZE_IN_BLOCKS=0x1000u -DCONFIG_SCHEDULER_THREADS_ENABLE -pthread
+
+echo
+printf "%-7s %12s %8s\n" "threads" "time(ms)" "speedup"
+$BIN/${BENCH} $THREADS || exit 1
+
+# The footprint is measured with the default settings in config.h, including
+# the default kernel memory region size, and fails if too few tasks fit.
+BENCH=footprint_bench
+build ${BENCH}
+
+echo
+printf "%10s %8s %8s %10s\n" "region(B)" "task(B)" "tasks" "min-free"
+$BIN/${BENCH} || exit 1
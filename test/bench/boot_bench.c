@@ -0,0 +1,88 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file boot_bench.c
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Benchmark sources
+ * @version 0.4.1
+ * @date 2023-03-19
+ *
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ *
+ */
+/*UNCRUSTIFY-ON*/
+#include "bench.h"
+
+
+/*UNCRUSTIFY-OFF*/
+/*
+ * Measures how long xSystemInit() takes. The first call is timed on its own
+ * because it is the only one that runs against memory the process has never
+ * touched, which is the closest a host gets to a cold boot. The calls after
+ * that are averaged. The latency of the first xMemAlloc() after start-up is
+ * also reported since that is where CONFIG_MEMORY_REGION_LAZY_INIT moves the
+ * cost of zeroing memory. bench.sh builds this file with and without
+ * CONFIG_MEMORY_REGION_LAZY_INIT and prints the results side by side.
+ */
+/*UNCRUSTIFY-ON*/
+#if defined(BOOT_BENCH_ITERATIONS)
+  #undef BOOT_BENCH_ITERATIONS
+#endif /* if defined(BOOT_BENCH_ITERATIONS) */
+#define BOOT_BENCH_ITERATIONS 0x100u /* 256 */
+
+
+#if defined(BOOT_BENCH_ALLOC_SIZE)
+  #undef BOOT_BENCH_ALLOC_SIZE
+#endif /* if defined(BOOT_BENCH_ALLOC_SIZE) */
+#define BOOT_BENCH_ALLOC_SIZE 0x400u /* 1024 */
+
+
+#if defined(CONFIG_MEMORY_REGION_LAZY_INIT)
+  #define BOOT_BENCH_MODE "lazy"
+#else  /* if defined(CONFIG_MEMORY_REGION_LAZY_INIT) */
+  #define BOOT_BENCH_MODE "eager"
+#endif /* if defined(CONFIG_MEMORY_REGION_LAZY_INIT) */
+
+
+int main(int argc, char **argv) {
+  Word_t i = zero;
+  Word_t coldNs = zero;
+  Word_t warmNs = zero;
+  Word_t allocNs = zero;
+  bench_time_t start;
+  volatile Addr_t *addr = null;
+
+
+  bench_now(&start);
+
+  if(!OK(xSystemInit())) {
+    return(1);
+  }
+
+  coldNs = bench_elapsed_ns(&start);
+  bench_now(&start);
+
+  if(!OK(xMemAlloc(&addr, BOOT_BENCH_ALLOC_SIZE))) {
+    return(1);
+  }
+
+  allocNs = bench_elapsed_ns(&start);
+
+  for(i = zero; i < BOOT_BENCH_ITERATIONS; i++) {
+    bench_now(&start);
+
+    if(!OK(xSystemInit())) {
+      return(1);
+    }
+
+    warmNs += bench_elapsed_ns(&start);
+  }
+
+  printf("%-6s %10lu %12lu %12.1f %14lu\n", BOOT_BENCH_MODE, (unsigned long) MEMORY_REGION_SIZE_IN_BYTES, (unsigned long) coldNs, (double) warmNs /
+    (double) BOOT_BENCH_ITERATIONS, (unsigned long) allocNs);
+
+  return(0);
+}
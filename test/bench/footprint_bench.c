@@ -0,0 +1,95 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file footprint_bench.c
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Benchmark sources
+ * @version 0.4.1
+ * @date 2023-03-19
+ *
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ *
+ */
+/*UNCRUSTIFY-ON*/
+#include "bench.h"
+
+
+/*UNCRUSTIFY-OFF*/
+/*
+ * Counts how many periodic tasks fit in the kernel memory region. Tasks are
+ * created, given a task timer and placed in the waiting state until a syscall
+ * fails, which is what an application does at start-up. bench.sh builds this
+ * file with the default settings in config.h so a change that makes the task
+ * or the kernel's own data structures larger than the default kernel memory
+ * region can hold is caught. The benchmark fails if fewer than
+ * FOOTPRINT_BENCH_MINIMUM_TASKS tasks fit.
+ */
+/*UNCRUSTIFY-ON*/
+#if defined(FOOTPRINT_BENCH_MAXIMUM_TASKS)
+  #undef FOOTPRINT_BENCH_MAXIMUM_TASKS
+#endif /* if defined(FOOTPRINT_BENCH_MAXIMUM_TASKS) */
+#define FOOTPRINT_BENCH_MAXIMUM_TASKS 0x40u /* 64 */
+
+
+#if defined(FOOTPRINT_BENCH_MINIMUM_TASKS)
+  #undef FOOTPRINT_BENCH_MINIMUM_TASKS
+#endif /* if defined(FOOTPRINT_BENCH_MINIMUM_TASKS) */
+#define FOOTPRINT_BENCH_MINIMUM_TASKS 0x3u /* 3 */
+
+
+#if defined(FOOTPRINT_BENCH_PERIOD)
+  #undef FOOTPRINT_BENCH_PERIOD
+#endif /* if defined(FOOTPRINT_BENCH_PERIOD) */
+#define FOOTPRINT_BENCH_PERIOD 0x5u /* 5 */
+
+
+static void __BenchTask__(Task_t *task_, TaskParm_t *parm_);
+
+
+int main(int argc, char **argv) {
+  Base_t tasks = zero;
+  Task_t *task = null;
+  MemoryRegionStats_t *stats = null;
+  Word_t minimum = zero;
+
+
+  if(!OK(xSystemInit())) {
+    return(1);
+  }
+
+  for(tasks = zero; tasks < FOOTPRINT_BENCH_MAXIMUM_TASKS; tasks++) {
+    if(!OK(xTaskCreate(&task, (Byte_t *) "FOOTPRNT", __BenchTask__, null))) {
+      break;
+    }
+
+    if(!OK(xTaskChangePeriod(task, FOOTPRINT_BENCH_PERIOD)) || !OK(xTaskWait(task))) {
+      /* The task was created but could not be made periodic so it does not
+       * count. */
+      xTaskDelete(task);
+      break;
+    }
+  }
+
+  if(!OK(xMemGetKernelStats(&stats))) {
+    return(1);
+  }
+
+  minimum = stats->minimumEverFreeBytesRemaining;
+  xMemFree(stats);
+  printf("%10lu %8lu %8u %10lu\n", (unsigned long) MEMORY_REGION_SIZE_IN_BYTES, (unsigned long) sizeof(Task_t), (unsigned int) tasks, (unsigned
+    long) minimum);
+
+  if(FOOTPRINT_BENCH_MINIMUM_TASKS > tasks) {
+    return(1);
+  }
+
+  return(0);
+}
+
+
+static void __BenchTask__(Task_t *task_, TaskParm_t *parm_) {
+  return;
+}
@@ -0,0 +1,189 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file mem_bench.c
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Benchmark sources
+ * @version 0.4.1
+ * @date 2023-03-19
+ * 
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *  
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  
+ * 
+ */
+/*UNCRUSTIFY-ON*/
+#include "bench.h"
+
+
+/*UNCRUSTIFY-OFF*/
+/*
+ * Runs the same allocation workloads against the heap memory region and
+ * reports, for each workload, the average latency of xMemAlloc() and
+ * xMemFree(), the number of allocations that failed and the external
+ * fragmentation of the heap at the end of the workload. The placement policy
+ * is a compile-time setting so bench.sh builds this file once for each
+ * CONFIG_MEMORY_PLACEMENT_POLICY and prints the results side by side.
+ */
+/*UNCRUSTIFY-ON*/
+#if defined(MEM_BENCH_SLOTS)
+  #undef MEM_BENCH_SLOTS
+#endif /* if defined(MEM_BENCH_SLOTS) */
+#define MEM_BENCH_SLOTS 0x100u /* 256 */
+
+
+#if defined(MEM_BENCH_OPERATIONS)
+  #undef MEM_BENCH_OPERATIONS
+#endif /* if defined(MEM_BENCH_OPERATIONS) */
+#define MEM_BENCH_OPERATIONS 0x30000u /* 196608 */
+
+
+#if defined(MEM_BENCH_MAP_ENTRIES)
+  #undef MEM_BENCH_MAP_ENTRIES
+#endif /* if defined(MEM_BENCH_MAP_ENTRIES) */
+#define MEM_BENCH_MAP_ENTRIES 0x1000u /* 4096 */
+
+
+typedef struct MemBenchSlot_s {
+  volatile Addr_t *ptr;
+  Word_t expires;
+} MemBenchSlot_t;
+typedef struct MemBenchResult_s {
+  Word_t allocs;
+  Word_t frees;
+  Word_t failures;
+  double allocNs;
+  double freeNs;
+} MemBenchResult_t;
+
+
+static MemBenchSlot_t slots[MEM_BENCH_SLOTS];
+static MemoryRegionMapEntry_t map[MEM_BENCH_MAP_ENTRIES];
+static Size_t __SizeUniform__(void);
+static Size_t __SizePowerOfTwo__(void);
+static Size_t __SizeBimodal__(void);
+static void __RunWorkload__(const char *name_, Size_t (*size_)(void), const Word_t maxLifetime_);
+static double __Fragmentation__(void);
+
+
+int main(int argc, char **argv) {
+  __RunWorkload__("uniform", __SizeUniform__, 0x40u);
+  __RunWorkload__("pow2", __SizePowerOfTwo__, 0x40u);
+  __RunWorkload__("bimodal", __SizeBimodal__, 0x200u);
+
+  return(0);
+}
+
+
+static Size_t __SizeUniform__(void) {
+  /* Anywhere from 1 byte to 1 KiB. */
+  return((Size_t) (bench_rand() % 0x400u) + 1);
+}
+
+
+static Size_t __SizePowerOfTwo__(void) {
+  /* 16 bytes to 2 KiB in powers of two. */
+  return((Size_t) 0x10u << (bench_rand() % 0x8u));
+}
+
+
+static Size_t __SizeBimodal__(void) {
+  /* Mostly small messages with the occasional large buffer. */
+  if(zero == (bench_rand() % 0x10u)) {
+    return((Size_t) (bench_rand() % 0x1000u) + 0x400u);
+  }
+
+  return((Size_t) (bench_rand() % 0x40u) + 1);
+}
+
+
+static void __RunWorkload__(const char *name_, Size_t (*size_)(void), const Word_t maxLifetime_) {
+  Word_t op = zero;
+  Word_t slot = zero;
+  Word_t allocNs = zero;
+  Word_t freeNs = zero;
+  bench_time_t start;
+  MemoryRegionStats_t *stats = null;
+  MemBenchResult_t result;
+
+
+  bench_reset();
+  bench_srand(0x2A);
+  memset(slots, 0x0, sizeof(slots));
+  memset(&result, 0x0, sizeof(result));
+
+  /* Each operation either frees a slot whose lifetime has run out or fills an
+   * empty slot with an allocation of the workload's size distribution. */
+  for(op = zero; op < MEM_BENCH_OPERATIONS; op++) {
+    slot = bench_rand() % MEM_BENCH_SLOTS;
+
+    if(NOTNULLPTR(slots[slot].ptr) && (op >= slots[slot].expires)) {
+      bench_now(&start);
+      xMemFree(slots[slot].ptr);
+      freeNs += bench_elapsed_ns(&start);
+      slots[slot].ptr = null;
+      result.frees++;
+    } else if(NULLPTR(slots[slot].ptr)) {
+      bench_now(&start);
+
+      if(OK(xMemAlloc(&slots[slot].ptr, (*size_)()))) {
+        allocNs += bench_elapsed_ns(&start);
+        slots[slot].expires = op + (bench_rand() % maxLifetime_) + 1;
+        result.allocs++;
+      } else {
+        slots[slot].ptr = null;
+        result.failures++;
+      }
+    }
+  }
+
+  if(zero < result.allocs) {
+    result.allocNs = (double) allocNs / (double) result.allocs;
+  }
+
+  if(zero < result.frees) {
+    result.freeNs = (double) freeNs / (double) result.frees;
+  }
+
+  printf("%-8s %-10s %10.1f %10.1f %8lu %8.3f", name_, BENCH_MEMORY_PLACEMENT_POLICY, result.allocNs, result.freeNs, (unsigned long) result.failures,
+    __Fragmentation__());
+
+  if(OK(xMemGetHeapStats(&stats))) {
+    printf(" %10lu\n", (unsigned long) stats->minimumEverFreeBytesRemaining);
+    xMemFree(stats);
+  } else {
+    printf(" %10s\n", "-");
+  }
+
+  return;
+}
+
+
+static double __Fragmentation__(void) {
+  HalfWord_t i = zero;
+  HalfWord_t entries = zero;
+  Word_t largest = zero;
+  Word_t free = zero;
+
+
+  /* External fragmentation, measured the same way as by the memmap tool: the
+   * share of free memory that cannot be handed out in a single allocation. */
+  if(OK(xMemGetRegionMap(MemoryRegionHeap, map, MEM_BENCH_MAP_ENTRIES, &entries))) {
+    for(i = zero; (i < entries) && (i < MEM_BENCH_MAP_ENTRIES); i++) {
+      if(true == map[i].free) {
+        free += map[i].blocks;
+
+        if(largest < map[i].blocks) {
+          largest = map[i].blocks;
+        }
+      }
+    }
+  }
+
+  if(zero == free) {
+    return(0.0);
+  }
+
+  return(1.0 - ((double) largest / (double) free));
+}
@@ -0,0 +1,174 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file sched_bench.c
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Benchmark sources
+ * @version 0.4.1
+ * @date 2023-03-19
+ *
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ *
+ */
+/*UNCRUSTIFY-ON*/
+#include "bench.h"
+
+
+/*UNCRUSTIFY-OFF*/
+/*
+ * Measures how the scheduler scales when it runs tasks on more than one
+ * thread. The same set of CPU-bound tasks is run to completion with
+ * xTaskStartSchedulerThreads() for every thread count from one up to
+ * CONFIG_SCHEDULER_THREADS_MAXIMUM, or the thread count given on the command
+ * line, and the wall clock time and speed-up over one thread are reported.
+ * Each task run also sends a message to a message queue and allocates and
+ * frees heap memory so the kernel lock is exercised the way a real task set
+ * would. bench.sh builds this file with CONFIG_SCHEDULER_THREADS_ENABLE.
+ */
+/*UNCRUSTIFY-ON*/
+#if defined(SCHED_BENCH_TASKS)
+  #undef SCHED_BENCH_TASKS
+#endif /* if defined(SCHED_BENCH_TASKS) */
+#define SCHED_BENCH_TASKS 0x10u /* 16 */
+
+
+#if defined(SCHED_BENCH_RUNS)
+  #undef SCHED_BENCH_RUNS
+#endif /* if defined(SCHED_BENCH_RUNS) */
+#define SCHED_BENCH_RUNS 0x200u /* 512 */
+
+
+#if defined(SCHED_BENCH_WORK)
+  #undef SCHED_BENCH_WORK
+#endif /* if defined(SCHED_BENCH_WORK) */
+#define SCHED_BENCH_WORK 0x8000u /* 32768 */
+
+
+static Base_t indexes[SCHED_BENCH_TASKS];
+static Word_t runs[SCHED_BENCH_TASKS];
+static volatile Word_t sink[SCHED_BENCH_TASKS];
+static Queue_t *queue = null;
+static void __BenchTask__(Task_t *task_, TaskParm_t *parm_);
+static void __BenchIdle__(void);
+static Word_t __RunThreads__(const Base_t threads_);
+
+
+int main(int argc, char **argv) {
+  Base_t threads = zero;
+  Base_t maximum = CONFIG_SCHEDULER_THREADS_MAXIMUM;
+  Word_t ns = zero;
+  Word_t baseNs = zero;
+
+
+  if((1 < argc) && (0 < atoi(argv[1])) && (CONFIG_SCHEDULER_THREADS_MAXIMUM >= (Base_t) atoi(argv[1]))) {
+    maximum = (Base_t) atoi(argv[1]);
+  }
+
+  for(threads = 1; threads <= maximum; threads++) {
+    ns = __RunThreads__(threads);
+
+    if(zero == ns) {
+      return(1);
+    }
+
+    if(1 == threads) {
+      baseNs = ns;
+    }
+
+    printf("%-7u %12.3f %8.2f\n", (unsigned int) threads, (double) ns / 1000000.0, (double) baseNs / (double) ns);
+  }
+
+  return(0);
+}
+
+
+static Word_t __RunThreads__(const Base_t threads_) {
+  Base_t i = zero;
+  Task_t *task = null;
+  bench_time_t start;
+  Word_t ns = zero;
+
+
+  bench_reset();
+  memset(runs, 0x0, sizeof(runs));
+
+  if(!OK(xQueueCreate(&queue, SCHED_BENCH_TASKS))) {
+    return(zero);
+  }
+
+  for(i = zero; i < SCHED_BENCH_TASKS; i++) {
+    indexes[i] = i;
+
+    if(!OK(xTaskCreate(&task, (Byte_t *) "SCHBENCH", __BenchTask__, &indexes[i])) || !OK(xTaskResume(task))) {
+      return(zero);
+    }
+  }
+
+  if(!OK(xTaskSetIdleHook(__BenchIdle__)) || !OK(xTaskResumeAll())) {
+    return(zero);
+  }
+
+  bench_now(&start);
+
+  if(!OK(xTaskStartSchedulerThreads(threads_))) {
+    return(zero);
+  }
+
+  ns = bench_elapsed_ns(&start);
+
+  for(i = zero; i < SCHED_BENCH_TASKS; i++) {
+    if(SCHED_BENCH_RUNS != runs[i]) {
+      return(zero);
+    }
+  }
+
+  return(ns);
+}
+
+
+static void __BenchTask__(Task_t *task_, TaskParm_t *parm_) {
+  Base_t index = zero;
+  Word_t i = zero;
+  Word_t acc = zero;
+  volatile Addr_t *addr = null;
+  QueueMessage_t *message = null;
+
+
+  index = DEREF_TASKPARM(Base_t, parm_);
+  acc = sink[index];
+
+  /* The same linear congruential generator as bench_rand() so the work cannot
+   * be optimized away. */
+  for(i = zero; i < SCHED_BENCH_WORK; i++) {
+    acc = (acc * 1103515245u) + 12345u;
+  }
+
+  sink[index] = acc;
+
+  if(OK(xMemAlloc(&addr, 0x40u))) {
+    xMemFree(addr);
+  }
+
+  if(OK(xQueueSend(queue, 0x1u, (Byte_t *) "S")) && OK(xQueueReceive(queue, &message))) {
+    xMemFree(message);
+  }
+
+  runs[index]++;
+
+  if(SCHED_BENCH_RUNS <= runs[index]) {
+    xTaskSuspend(task_);
+  }
+
+  return;
+}
+
+
+static void __BenchIdle__(void) {
+  /* Every task has suspended itself so the run is over. */
+  xTaskSuspendAll();
+
+  return;
+}
@@ -68,7 +68,7 @@ Return_t TO_FUNCTION(DEVICE_NAME, _config)(Device_t * device_, Size_t *size_, Ad
   Return_t TO_FUNCTION(DEVICE_NAME, _read)(Device_t * device_, Size_t *size_, Addr_t **data_) {
   RET_DEFINE;
 
-  __KernelAllocateMemory__((volatile Addr_t **) data_, loopback_buffer_size);
+  __DeviceAllocateMemory__((volatile Addr_t **) data_, loopback_buffer_size);
 
   __memcpy__(*data_, loopback_buffer, loopback_buffer_size);
 
@@ -25,17 +25,51 @@ static Size_t order[0x20u] = {
   0x1Au, 0x04u, 0x13u, 0x11u, 0x1Fu, 0x12u, 0x17u, 0x15u, 0x14u, 0x1Bu
 };
 static MemoryTest_t tests[0x20u];
+static MemoryRegionMapEntry_t map[0x10u];
+
+
+/* The kernel memory region statistics below are exact only when none of the
+ * settings that make a task or the task list larger are defined. Otherwise
+ * they are worked out from the sizes of the task and the task list. */
+#if !defined(CONFIG_TASK_WD_TIMER_ENABLE) && !defined(CONFIG_TICKS_64BIT_ENABLE) && !defined(CONFIG_TASK_INDEX_ENABLE) && \
+  !defined(CONFIG_TASK_RELEASE_STATS_ENABLE) && !defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) && !defined(CONFIG_TASK_EDF_ENABLE) && \
+  !defined(CONFIG_TASK_HISTOGRAM_ENABLE) && !defined(CONFIG_TASK_UTILIZATION_ENABLE) && !defined(CONFIG_TASK_AWAIT_ENABLE) && \
+  !defined(CONFIG_TASK_STACKFUL_ENABLE) && !defined(CONFIG_SCHEDULER_THREADS_ENABLE) && (CONFIG_SCHEDULER_CORES == 0x1u) && \
+  (CONFIG_TASK_NAME_BYTES == 0x8u) && !defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+  #define MEMORY_1_HARNESS_DEFAULT_TASK
+#endif /* if !defined(CONFIG_TASK_WD_TIMER_ENABLE) && ... */
 
 
 void memory_1_harness(void) {
   Size_t i;
   Size_t used;
   Size_t actual;
+
+#if !defined(MEMORY_1_HARNESS_DEFAULT_TASK)
+    Size_t kernel;
+#endif /* if !defined(MEMORY_1_HARNESS_DEFAULT_TASK) */
+
   Base_t *mem01;
   MemoryRegionStats_t *mem02;
   MemoryRegionStats_t *mem03;
   Task_t *mem04 = null;
   Byte_t *mem05 = null;
+  Byte_t *mem06 = null;
+  Byte_t *mem07 = null;
+  HalfWord_t mem08 = zero;
+
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+    Byte_t *mem09 = null;
+    Byte_t *mem10 = null;
+    Byte_t *mem11 = null;
+    MemoryRegionStats_t *mem12 = null;
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+
+#if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+    CriticalSectionStats_t *mem13 = null;
+    Word_t mem14 = zero;
+    Word_t mem15 = zero;
+#endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
 
 
   unit_begin("Unit test for memory region defragmentation routine");
@@ -107,17 +141,151 @@ void memory_1_harness(void) {
   unit_try(OK(xTaskDelete(mem04)));
   unit_try(OK(xMemGetKernelStats(&mem03)));
   unit_try(null != mem03);
-  unit_try(0x383C0u == mem03->availableSpaceInBytes);
-  unit_try(0x383C0u == mem03->largestFreeEntryInBytes);
-  unit_try(0x38340u == mem03->minimumEverFreeBytesRemaining);
-  unit_try(0x1C1Eu == mem03->numberOfFreeBlocks);
-  unit_try(0x383C0u == mem03->smallestFreeEntryInBytes);
-  unit_try(0x2u == mem03->successfulAllocations);
+
+#if defined(MEMORY_1_HARNESS_DEFAULT_TASK)
+    unit_try(0x383C0u == mem03->availableSpaceInBytes);
+    unit_try(0x383C0u == mem03->largestFreeEntryInBytes);
+    unit_try(0x38340u == mem03->minimumEverFreeBytesRemaining);
+    unit_try(0x1C1Eu == mem03->numberOfFreeBlocks);
+    unit_try(0x383C0u == mem03->smallestFreeEntryInBytes);
+#else  /* if defined(MEMORY_1_HARNESS_DEFAULT_TASK) */
+
+  #if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+
+      /* The task list is not allocated from the kernel memory region. */
+      kernel = 0x38400u;
+  #else  /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+
+      /* The task list stays allocated after the task is deleted. Its size, like
+       * the size of a task, depends on the configuration so work out how many
+       * blocks it took, plus one for its memory entry. */
+      kernel = 0x38400u - ((((sizeof(TaskList_t) + CONFIG_MEMORY_REGION_BLOCK_SIZE - 1u) / CONFIG_MEMORY_REGION_BLOCK_SIZE) + 1u) *
+        CONFIG_MEMORY_REGION_BLOCK_SIZE);
+  #endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+    unit_try(kernel == mem03->availableSpaceInBytes);
+    unit_try(kernel == mem03->largestFreeEntryInBytes);
+    unit_try((kernel - ((((sizeof(Task_t) + CONFIG_MEMORY_REGION_BLOCK_SIZE - 1u) / CONFIG_MEMORY_REGION_BLOCK_SIZE) + 1u) * CONFIG_MEMORY_REGION_BLOCK_SIZE))
+      == mem03->minimumEverFreeBytesRemaining);
+    unit_try((kernel / CONFIG_MEMORY_REGION_BLOCK_SIZE) == mem03->numberOfFreeBlocks);
+    unit_try(kernel == mem03->smallestFreeEntryInBytes);
+#endif /* if defined(MEMORY_1_HARNESS_DEFAULT_TASK) */
+
+#if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+    unit_try(0x1u == mem03->successfulAllocations);
+#else  /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+    unit_try(0x2u == mem03->successfulAllocations);
+#endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
   unit_try(0x1u == mem03->successfulFrees);
   unit_try(OK(xMemFree(mem01)));
   unit_try(OK(xMemFree(mem02)));
   unit_try(OK(xMemFree(mem03)));
   unit_end();
+  unit_begin("xMemGetRegionMap()");
+  unit_try(OK(xMemAlloc((volatile Addr_t **) &mem06, 0x40u)));
+  unit_try(OK(xMemAlloc((volatile Addr_t **) &mem07, 0x40u)));
+  unit_try(OK(xMemFree(mem06)));
+  unit_try(OK(xMemGetRegionMap(MemoryRegionHeap, map, 0x10u, &mem08)));
+  unit_try(0x3u == mem08);
+  unit_try(0x0u == map[0].offset);
+  unit_try(0x3u == map[0].blocks);
+  unit_try(true == map[0].free);
+  unit_try(0x3u == map[1].offset);
+  unit_try(0x3u == map[1].blocks);
+  unit_try(false == map[1].free);
+  unit_try(0x6u == map[2].offset);
+  unit_try((CONFIG_MEMORY_REGION_SIZE_IN_BLOCKS - 0x6u) == map[2].blocks);
+  unit_try(true == map[2].free);
+  mem08 = zero;
+  map[1].offset = zero;
+  unit_try(OK(xMemGetRegionMap(MemoryRegionKernel, map, 0x1u, &mem08)));
+
+#if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+    unit_try(0x1u == mem08);
+#else  /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+    unit_try(0x2u == mem08);
+#endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+  unit_try(OK(xMemGetRegionMap(MemoryRegionHeap, map, 0x1u, &mem08)));
+  unit_try(0x3u == mem08);
+  unit_try(0x0u == map[1].offset);
+  unit_try(!OK(xMemGetRegionMap(MemoryRegionHeap, map, 0x0u, &mem08)));
+  unit_try(OK(xMemFree(mem07)));
+  unit_end();
+
+#if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE)
+    unit_begin("Unit test for buddy memory region");
+    unit_try(OK(__BuddyAllocateMemory__((volatile Addr_t **) &mem09, 0x20u)));
+    unit_try(OK(__BuddyAllocateMemory__((volatile Addr_t **) &mem10, 0x40u)));
+    unit_try(OK(__BuddyAllocateMemory__((volatile Addr_t **) &mem11, 0x21u)));
+    unit_try(zero == ((Size_t) mem09 % 0x20u));
+
+  #if CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER >= 0x6u
+      unit_try(zero == ((Size_t) mem10 % 0x40u));
+      unit_try(zero == ((Size_t) mem11 % 0x40u));
+  #endif /* if CONFIG_MEMORY_BUDDY_REGION_ALIGN_ORDER >= 0x6u */
+    unit_try(0x40u == (mem10 - mem09));
+    unit_try(0x80u == (mem11 - mem09));
+    unit_try(OK(__MemoryRegionCheckBuddy__(mem10, MEMORY_REGION_CHECK_OPTION_W_ADDR)));
+    unit_try(!OK(__MemoryRegionCheckBuddy__(mem10 + 0x20u, MEMORY_REGION_CHECK_OPTION_W_ADDR)));
+    unit_try(OK(xMemGetBuddyStats(&mem12)));
+    unit_try(null != mem12);
+    unit_try((BUDDY_REGION_SIZE_IN_BYTES - 0xA0u) == mem12->availableSpaceInBytes);
+    unit_try((BUDDY_REGION_SIZE_IN_BYTES / 0x2u) == mem12->largestFreeEntryInBytes);
+    unit_try(0x20u == mem12->smallestFreeEntryInBytes);
+    unit_try(0x3u == mem12->successfulAllocations);
+    unit_try(OK(xMemFree(mem12)));
+    unit_try(!OK(__BuddyFreeMemory__(mem09 + 0x1u)));
+    unit_try(OK(__BuddyFreeMemory__(mem10)));
+    unit_try(!OK(__BuddyFreeMemory__(mem10)));
+    unit_try(OK(__BuddyFreeMemory__(mem09)));
+    unit_try(OK(__BuddyFreeMemory__(mem11)));
+    unit_try(OK(__MemoryRegionCheckBuddy__(null, MEMORY_REGION_CHECK_OPTION_WO_ADDR)));
+    unit_try(!OK(__BuddyAllocateMemory__((volatile Addr_t **) &mem09, BUDDY_REGION_SIZE_IN_BYTES + 0x1u)));
+    unit_try(OK(__BuddyAllocateMemory__((volatile Addr_t **) &mem09, BUDDY_REGION_SIZE_IN_BYTES)));
+    unit_try(zero == ((Size_t) mem09 % BUDDY_REGION_ALIGNMENT));
+    unit_try(!OK(__BuddyAllocateMemory__((volatile Addr_t **) &mem10, 0x1u)));
+    unit_try(OK(__BuddyFreeMemory__(mem09)));
+    unit_try(OK(xMemGetBuddyStats(&mem12)));
+    unit_try(null != mem12);
+    unit_try(BUDDY_REGION_SIZE_IN_BYTES == mem12->availableSpaceInBytes);
+    unit_try(BUDDY_REGION_SIZE_IN_BYTES == mem12->largestFreeEntryInBytes);
+    unit_try(zero == mem12->minimumEverFreeBytesRemaining);
+    unit_try(0x4u == mem12->successfulFrees);
+    unit_try(OK(xMemFree(mem12)));
+    unit_end();
+#endif /* if defined(CONFIG_MEMORY_BUDDY_REGION_ENABLE) */
+
+#if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE)
+    unit_begin("xSystemGetCriticalSectionStats()");
+    unit_try(OK(xSystemGetCriticalSectionStats(CriticalSiteMemAlloc, &mem13)));
+    unit_try(null != mem13);
+    unit_try(zero < mem13->count);
+    mem14 = mem13->count;
+    mem15 = zero;
+
+    for(i = 0; i < CRITICAL_SECTION_HISTOGRAM_BUCKETS; i++) {
+      mem15 += mem13->histogram[i];
+    }
+
+    unit_try(mem14 == mem15);
+    unit_try(OK(xMemFree(mem13)));
+    unit_try(OK(xMemAlloc((volatile Addr_t **) &mem05, 0x40u)));
+    unit_try(OK(xMemAlloc((volatile Addr_t **) &mem06, 0x40u)));
+    unit_try(OK(xMemFree(mem05)));
+    unit_try(OK(xMemFree(mem06)));
+    unit_try(OK(xSystemGetCriticalSectionStats(CriticalSiteMemAlloc, &mem13)));
+    unit_try(null != mem13);
+
+
+    /* Two allocations by the test and one for the statistics themselves. */
+    unit_try((mem14 + 0x3u) == mem13->count);
+    unit_try(OK(xMemFree(mem13)));
+    unit_try(OK(xSystemGetCriticalSectionStats(CriticalSiteMemFree, &mem13)));
+    unit_try(null != mem13);
+    unit_try(0x2u <= mem13->count);
+    unit_try(OK(xMemFree(mem13)));
+    unit_try(ERROR(xSystemGetCriticalSectionStats((CriticalSite_t) CRITICAL_SITES, &mem13)));
+    unit_end();
+#endif /* if defined(CONFIG_CRITICAL_SECTION_STATS_ENABLE) */
 
   return;
 }
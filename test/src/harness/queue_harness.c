@@ -17,9 +17,15 @@
 #include "queue_harness.h"
 
 
+static Byte_t queue_harness_storage[0x100];
+
+
 void queue_harness(void) {
   Queue_t *queue01;
   QueueMessage_t *queue02;
+  MemoryRegionStats_t *queue03;
+  Size_t queue04;
+  Size_t queue05;
   Base_t res;
 
 
@@ -94,6 +100,34 @@ void queue_harness(void) {
   unit_try(OK(xQueueDelete(queue01)));
   unit_try(!OK(xQueueSend(queue01, 0x8, (Byte_t *) "MESSAGE4")));
   unit_end();
+  unit_begin("xQueueCreateStatic()");
+  queue01 = null;
+  queue03 = null;
+  unit_try(OK(xSystemGetStaticSize(StaticObjectQueue, &queue04)));
+  unit_try(sizeof(queue_harness_storage) > queue04);
+  unit_try(OK(xMemGetKernelStats(&queue03)));
+  unit_try(null != queue03);
+  queue05 = queue03->successfulAllocations;
+  unit_try(OK(xMemFree(queue03)));
+  unit_try(!OK(xQueueCreateStatic(&queue01, queue_harness_storage + 0x1u, queue04 - 0x1u, 0x7)));
+  unit_try(OK(xQueueCreateStatic(&queue01, queue_harness_storage + 0x1u, queue04, 0x7)));
+  unit_try(null != queue01);
+  unit_try(!OK(xQueueCreateStatic(&queue01, queue_harness_storage + 0x1u, queue04, 0x7)));
+  unit_try(OK(xMemGetKernelStats(&queue03)));
+  unit_try(queue05 == queue03->successfulAllocations);
+  unit_try(OK(xMemFree(queue03)));
+  unit_try(OK(xQueueSend(queue01, 0x8, (Byte_t *) "MESSAGE1")));
+  unit_try(OK(xQueueReceive(queue01, &queue02)));
+  unit_try(0x0u == strncmp("MESSAGE1", (char *) queue02->messageValue, 0x8));
+  unit_try(OK(xMemFree(queue02)));
+  unit_try(OK(xQueueSend(queue01, 0x8, (Byte_t *) "MESSAGE2")));
+  unit_try(OK(xQueueDelete(queue01)));
+  unit_try(!OK(xQueueSend(queue01, 0x8, (Byte_t *) "MESSAGE3")));
+  unit_try(OK(xQueueCreateStatic(&queue01, queue_harness_storage + 0x1u, queue04, 0x7)));
+  unit_try(OK(xQueueGetLength(queue01, &res)));
+  unit_try(0x0u == res);
+  unit_try(OK(xQueueDelete(queue01)));
+  unit_end();
 
   return;
 }
\ No newline at end of file
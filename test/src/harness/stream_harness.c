@@ -17,12 +17,16 @@
 #include "stream_harness.h"
 
 
+static Byte_t stream_harness_storage[0x80];
+
+
 void stream_harness(void) {
   StreamBuffer_t *stream01 = null;
   HalfWord_t i = zero;
   HalfWord_t stream02 = zero;
   Byte_t *stream03 = null;
   HalfWord_t stream04 = zero;
+  Size_t stream05 = zero;
   Base_t res;
 
 
@@ -74,6 +78,19 @@ void stream_harness(void) {
   unit_try(OK(xStreamDelete(stream01)));
   unit_try(!OK(xStreamSend(stream01, zero)));
   unit_end();
+  unit_begin("xStreamCreateStatic()");
+  stream01 = null;
+  unit_try(OK(xSystemGetStaticSize(StaticObjectStream, &stream05)));
+  unit_try(sizeof(stream_harness_storage) >= stream05);
+  unit_try(!OK(xStreamCreateStatic(&stream01, stream_harness_storage, stream05 - 0x1u)));
+  unit_try(OK(xStreamCreateStatic(&stream01, stream_harness_storage, stream05)));
+  unit_try(null != stream01);
+  unit_try(OK(xStreamSend(stream01, 0x7u)));
+  unit_try(OK(xStreamBytesAvailable(stream01, &stream04)));
+  unit_try(0x1u == stream04);
+  unit_try(OK(xStreamDelete(stream01)));
+  unit_try(!OK(xStreamSend(stream01, zero)));
+  unit_end();
 
   return;
 }
\ No newline at end of file
@@ -17,6 +17,34 @@
 #include "task_harness.h"
 
 
+static Word_t task_harness_idle = zero;
+static Base_t task_harness_sequence = zero;
+static Task_t *task_harness_worker = null;
+static Byte_t task_harness_storage[0x800];
+static Task_t *task_harness_coroutine = null;
+static Queue_t *task_harness_queue = null;
+static StreamBuffer_t *task_harness_stream = null;
+static Base_t task_harness_step = zero;
+static Word_t task_harness_runs = zero;
+static Ticks_t task_harness_delayed = zero;
+static Byte_t task_harness_received = zero;
+static TaskState_t task_harness_state = TaskStateSuspended;
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+  static Base_t task_harness_index[0x4u] = {
+    0x0u, 0x1u, 0x2u, 0x3u
+  };
+  static Task_t *task_harness_pinned[0x4u];
+  static Word_t task_harness_cores[0x4u];
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+static Base_t task_harness_busy[0x4u];
+static Word_t task_harness_count[0x4u];
+static Word_t task_harness_sent[0x4u];
+static Word_t task_harness_overlaps = zero;
+static Word_t task_harness_taken = zero;
+static Word_t task_harness_bits = zero;
+
+
 void task_harness(void) {
   Task_t *task01;
   Task_t *task02;
@@ -46,6 +74,62 @@ void task_harness(void) {
   TaskState_t task26;
   TaskState_t task27;
   Ticks_t task28 = zero;
+  Task_t *task29 = null;
+  Task_t *task30 = null;
+  Task_t *task31 = null;
+  Base_t task32 = zero;
+  Base_t task33 = zero;
+  Base_t task34 = zero;
+  Base_t task35 = zero;
+  Base_t task36 = zero;
+  Base_t task37 = zero;
+  Base_t task38 = zero;
+  Base_t task39 = zero;
+  Ticks_t task40 = zero;
+  Ticks_t task41 = zero;
+  Base_t task42 = zero;
+  Base_t task43 = zero;
+  Base_t task44 = zero;
+  Base_t task45 = zero;
+  Base_t task46 = zero;
+  Ticks_t task47 = zero;
+  Base_t task48 = zero;
+  Base_t task49 = zero;
+  TaskReleasePolicy_t task50;
+  TaskHistogram_t *task51 = null;
+  Base_t task52 = zero;
+  Base_t task53 = zero;
+  TraceEvent_t *task54 = null;
+  HalfWord_t task55 = zero;
+  Base_t task56 = zero;
+  HalfWord_t task57 = zero;
+  TaskInfo_t *task58 = null;
+  Task_t *task59[0x14u];
+  Byte_t task60[CONFIG_TASK_NAME_BYTES];
+  Base_t task61 = zero;
+  MemoryRegionStats_t *task62 = null;
+  Word_t task63 = zero;
+  Base_t task64 = zero;
+  Size_t task65 = zero;
+  Task_t *task66 = null;
+  Word_t task67 = zero;
+
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+    HalfWord_t task68 = zero;
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+    QueueMessage_t *task69 = null;
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    Task_t *task70[0x4u];
+    Word_t task71 = zero;
+    Size_t task72 = zero;
+    Size_t task73 = zero;
+    Base_t task74 = zero;
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  Word_t task75 = zero;
 
 
   unit_begin("xTaskCreate()");
@@ -65,6 +149,73 @@ void task_harness(void) {
   unit_try(OK(xTaskGetHandleById(&task02, task03)));
   unit_try(task02 == task01);
   unit_end();
+  unit_begin("Unit test for task lookup indexes");
+
+  /* Create more tasks than there are buckets so some buckets hold more than
+   * one task. */
+  __memset__(task60, 'X', CONFIG_TASK_NAME_BYTES);
+
+  for(task61 = zero; task61 < (0x14u); task61++) {
+    task60[0] = (Byte_t) ('A' + (task61 % 0x1Au));
+    task60[1] = (Byte_t) ('A' + (task61 / 0x1Au));
+    unit_try(OK(xTaskCreate(&task59[task61], task60, task_harness_task, null)));
+  }
+
+  for(task61 = zero; task61 < (0x14u); task61++) {
+    task60[0] = (Byte_t) ('A' + (task61 % 0x1Au));
+    task60[1] = (Byte_t) ('A' + (task61 / 0x1Au));
+    task02 = null;
+    unit_try(OK(xTaskGetHandleByName(&task02, task60)));
+    unit_try(task02 == task59[task61]);
+    task02 = null;
+    unit_try(OK(xTaskGetHandleById(&task02, task59[task61]->id)));
+    unit_try(task02 == task59[task61]);
+  }
+
+  task03 = task59[0x5u]->id;
+  unit_try(OK(xTaskDelete(task59[0x5u])));
+  task60[0] = (Byte_t) 'F';
+  task60[1] = (Byte_t) 'A';
+  unit_try(!OK(xTaskGetHandleByName(&task02, task60)));
+  unit_try(!OK(xTaskGetHandleById(&task02, task03)));
+
+  for(task61 = zero; task61 < (0x14u); task61++) {
+    if(0x5u != task61) {
+      unit_try(OK(xTaskDelete(task59[task61])));
+    }
+  }
+
+  task02 = null;
+  unit_try(OK(xTaskGetHandleByName(&task02, (Byte_t *) "TASK01")));
+  unit_try(task02 == task01);
+  unit_end();
+  unit_begin("Unit test for task handle validation");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task, null)));
+  unit_try(OK(xTaskResume(task29)));
+  unit_try(!OK(xTaskResume((Task_t *) &task61)));
+  unit_try(!OK(xTaskResume((Task_t *) (((Byte_t *) task29) + CONFIG_MEMORY_REGION_BLOCK_SIZE))));
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(!OK(xTaskResume(task29)));
+  unit_try(!OK(xTaskDelete(task29)));
+  unit_end();
+  unit_begin("Unit test for task create and delete while running");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task6, &task64)));
+  unit_try(OK(xTaskResume(task29)));
+  unit_try(OK(xTaskGetNumberOfTasks(&task05)));
+  unit_try(OK(xMemGetKernelStats(&task62)));
+  task63 = task62->availableSpaceInBytes;
+  unit_try(OK(xMemFree(task62)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task64);
+  unit_try(!OK(xTaskResume(task_harness_worker)));
+  unit_try(OK(xTaskGetNumberOfTasks(&task06)));
+  unit_try(task05 == task06);
+  unit_try(OK(xMemGetKernelStats(&task62)));
+  unit_try(task63 == task62->availableSpaceInBytes);
+  unit_try(OK(xMemFree(task62)));
+  unit_try(OK(xTaskDelete(task29)));
+  unit_end();
   unit_begin("xTaskGetAllRunTimeStats()");
   task04 = null;
   task05 = 0;
@@ -219,6 +370,700 @@ void task_harness(void) {
   unit_try(OK(xTaskGetWDPeriod(task12, &task28)));
   unit_try(0x7D0u == task28);
   unit_end();
+  unit_begin("Unit test for ready heap");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task32)));
+  unit_try(OK(xTaskCreate(&task30, (Byte_t *) "TASK30", task_harness_task3, &task33)));
+  unit_try(OK(xTaskCreate(&task31, (Byte_t *) "TASK31", task_harness_task3, &task34)));
+  task29->totalRunTime = 0x1Eu;
+  task30->totalRunTime = 0xAu;
+  task31->totalRunTime = 0x14u;
+  unit_try(OK(xTaskResume(task29)));
+  unit_try(OK(xTaskResume(task30)));
+  unit_try(OK(xTaskResume(task31)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x0u == task32);
+  unit_try(0x1u == task33);
+  unit_try(0x0u == task34);
+  unit_try(OK(xTaskSuspend(task30)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x0u == task32);
+  unit_try(0x1u == task33);
+  unit_try(0x1u == task34);
+  unit_try(OK(xTaskWait(task31)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task32);
+  unit_try(0x1u == task33);
+  unit_try(0x1u == task34);
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(OK(xTaskDelete(task30)));
+  unit_try(OK(xTaskDelete(task31)));
+  unit_end();
+  unit_begin("Unit test for timer heap");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task35)));
+  unit_try(OK(xTaskCreate(&task30, (Byte_t *) "TASK30", task_harness_task3, &task36)));
+  unit_try(OK(xTaskCreate(&task31, (Byte_t *) "TASK31", task_harness_task3, &task37)));
+  unit_try(OK(xTaskChangePeriod(task29, 0x1F4u)));
+  unit_try(OK(xTaskChangePeriod(task30, 0x64u)));
+  unit_try(OK(xTaskChangePeriod(task31, 0x32u)));
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskWait(task30)));
+  unit_try(OK(xTaskWait(task31)));
+  unit_try(OK(xTaskResetTimer(task29)));
+  unit_try(OK(xTaskResetTimer(task30)));
+  unit_try(OK(xTaskResetTimer(task31)));
+  unit_try(OK(xTaskChangePeriod(task31, zero)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x0u == task35);
+  unit_try(0x1u == task36);
+  unit_try(0x0u == task37);
+  unit_try(OK(xTaskSuspend(task30)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task35);
+  unit_try(0x1u == task36);
+  unit_try(0x0u == task37);
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(OK(xTaskDelete(task30)));
+  unit_try(OK(xTaskDelete(task31)));
+  unit_end();
+  unit_begin("Unit test for pending list");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task38)));
+  unit_try(OK(xTaskCreate(&task30, (Byte_t *) "TASK30", task_harness_task3, &task39)));
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskWait(task30)));
+  unit_try(OK(xTaskNotifyGive(task30, 0x7, (Byte_t *) "MESSAGE")));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x0u == task38);
+  unit_try(0x1u == task39);
+  unit_try(OK(xTaskNotifyStateClear(task30)));
+  unit_try(OK(xTaskNotifyGive(task29, 0x7, (Byte_t *) "MESSAGE")));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task38);
+  unit_try(0x1u == task39);
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(OK(xTaskDelete(task30)));
+  unit_end();
+  unit_begin("Unit test for counting and bitwise notifications");
+#if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE)
+    task_harness_taken = zero;
+    task_harness_bits = zero;
+
+
+    /* A task deleted before the scheduler has looked at its notification must
+     * be taken off of the signalled list. */
+    unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task14, null)));
+    unit_try(OK(xTaskNotifyGiveCount(task29)));
+    unit_try(OK(xTaskDelete(task29)));
+    unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task14, null)));
+    unit_try(OK(xTaskWait(task29)));
+
+
+    /* Unlike xTaskNotifyGive(), a burst given while one is still waiting is
+     * not lost. */
+    for(task75 = zero; task75 < 0x3u; task75++) {
+      unit_try(OK(xTaskNotifyGiveCount(task29)));
+    }
+
+    unit_try(OK(xTaskNotifyGiveCountFromISR(task29)));
+    unit_try(OK(xTaskNotifyGiveCountFromISR(task29)));
+    unit_try(OK(xTaskNotifyGiveBits(task29, 0x1u)));
+    unit_try(OK(xTaskNotifyGiveBitsFromISR(task29, 0x4u)));
+    unit_try(!OK(xTaskNotifyGiveBits(task29, zero)));
+    unit_try(!OK(xTaskNotifyGiveBitsFromISR(task29, zero)));
+    unit_try(OK(xTaskNotificationIsWaiting(task29, &task15)));
+    unit_try(true == task15);
+    unit_try(OK(xTaskResumeAll()));
+    unit_try(OK(xTaskStartScheduler()));
+    unit_try(0x5u == task_harness_taken);
+    unit_try(0x5u == task_harness_bits);
+    unit_try(OK(xTaskNotificationIsWaiting(task29, &task15)));
+    unit_try(false == task15);
+    unit_try(OK(xTaskNotifyTakeCount(task29, &task75)));
+    unit_try(zero == task75);
+    unit_try(OK(xTaskNotifyGiveCount(task29)));
+    unit_try(OK(xTaskNotifyGiveBits(task29, 0x2u)));
+    unit_try(OK(xTaskNotifyStateClear(task29)));
+    unit_try(OK(xTaskNotifyTakeBits(task29, &task75)));
+    unit_try(zero == task75);
+    unit_try(!OK(xTaskNotifyStateClear(task29)));
+    unit_try(OK(xTaskDelete(task29)));
+#else  /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+    unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task14, null)));
+    unit_try(!OK(xTaskNotifyGiveCount(task29)));
+    unit_try(!OK(xTaskNotifyGiveBits(task29, 0x1u)));
+    unit_try(!OK(xTaskNotifyGiveCountFromISR(task29)));
+    unit_try(!OK(xTaskNotifyGiveBitsFromISR(task29, 0x1u)));
+    unit_try(!OK(xTaskNotifyTakeCount(task29, &task75)));
+    unit_try(!OK(xTaskNotifyTakeBits(task29, &task75)));
+    unit_try(OK(xTaskDelete(task29)));
+#endif /* if defined(CONFIG_TASK_NOTIFY_EVENTS_ENABLE) */
+  unit_end();
+  unit_begin("xTaskCreateWithPriority()");
+  unit_try(OK(xTaskCreateWithPriority(&task29, (Byte_t *) "TASK29", task_harness_task3, &task42, 0x1u)));
+  unit_try(OK(xTaskCreateWithPriority(&task30, (Byte_t *) "TASK30", task_harness_task3, &task43, 0x2u)));
+  unit_try(OK(xTaskCreate(&task31, (Byte_t *) "TASK31", task_harness_task3, &task44)));
+  task30->totalRunTime = 0x64u;
+  unit_try(OK(xTaskResume(task29)));
+  unit_try(OK(xTaskResume(task30)));
+  unit_try(OK(xTaskResume(task31)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x0u == task42);
+  unit_try(0x1u == task43);
+  unit_try(0x0u == task44);
+  unit_end();
+  unit_begin("xTaskGetPriority()");
+  task24 = zero;
+  unit_try(OK(xTaskGetPriority(task30, &task24)));
+  unit_try(0x2u == task24);
+  unit_try(OK(xTaskGetPriority(task31, &task24)));
+  unit_try(0x0u == task24);
+  unit_end();
+  unit_begin("xTaskChangePriority()");
+  unit_try(!OK(xTaskChangePriority(task31, CONFIG_TASK_PRIORITY_LEVELS)));
+  unit_try(OK(xTaskChangePriority(task31, CONFIG_TASK_PRIORITY_LEVELS - 1)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x0u == task42);
+  unit_try(0x1u == task43);
+  unit_try(0x1u == task44);
+  unit_try(OK(xTaskChangePriority(task31, zero)));
+  unit_try(OK(xTaskSuspend(task30)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task42);
+  unit_try(0x1u == task43);
+  unit_try(0x1u == task44);
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(OK(xTaskDelete(task30)));
+  unit_try(OK(xTaskDelete(task31)));
+  unit_end();
+  unit_begin("Unit test for deadline heap");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task4, &task45)));
+  unit_try(OK(xTaskCreate(&task30, (Byte_t *) "TASK30", task_harness_task4, &task46)));
+  unit_try(OK(xTaskChangePeriod(task29, 0xC8u)));
+  unit_try(OK(xTaskChangePeriod(task30, 0x4Bu)));
+  task47 = __PortGetSysTicks__();
+  task29->timerStartTime = task47 - 0x1C2u;
+  task30->timerStartTime = task47 - 0xFAu;
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskWait(task30)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+#if defined(CONFIG_TASK_EDF_ENABLE)
+    unit_try(0x2u == task45);
+    unit_try(0x1u == task46);
+#else  /* if defined(CONFIG_TASK_EDF_ENABLE) */
+    unit_try(0x1u == task45);
+    unit_try(0x2u == task46);
+#endif /* if defined(CONFIG_TASK_EDF_ENABLE) */
+  unit_end();
+  unit_begin("Unit test for deadline misses");
+  task04 = null;
+  unit_try(OK(xTaskGetTaskRunTimeStats(task29, &task04)));
+  unit_try(null != task04);
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+    unit_try(0x1u == task04->deadlineMisses);
+#else  /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+    unit_try(zero == task04->deadlineMisses);
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+  unit_try(OK(xMemFree(task04)));
+  task04 = null;
+  unit_try(OK(xTaskGetTaskRunTimeStats(task30, &task04)));
+  unit_try(null != task04);
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+    unit_try(0x1u == task04->deadlineMisses);
+#else  /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+    unit_try(zero == task04->deadlineMisses);
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+  unit_try(OK(xMemFree(task04)));
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(OK(xTaskDelete(task30)));
+  unit_end();
+  unit_begin("xTaskChangeReleasePolicy()");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task48)));
+  unit_try(OK(xTaskCreate(&task30, (Byte_t *) "TASK30", task_harness_task3, &task49)));
+  unit_try(OK(xTaskChangeReleasePolicy(task29, TaskReleasePolicySkip)));
+  unit_try(OK(xTaskChangeReleasePolicy(task30, TaskReleasePolicyCatchUp)));
+  unit_try(OK(xTaskChangePeriod(task29, 0x64u)));
+  unit_try(OK(xTaskChangePeriod(task30, 0x64u)));
+  task47 = __PortGetSysTicks__();
+  task29->timerStartTime = task47 - 0x1F4u;
+  task30->timerStartTime = task47 - 0xFAu;
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskWait(task30)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task48);
+  unit_try(zero < task49);
+  unit_try(zero == ((Ticks_t) (task29->timerStartTime - task47 + 0x1F4u) % 0x64u));
+  unit_try(0x64u >= (Ticks_t) (__PortGetSysTicks__() - task29->timerStartTime));
+  unit_try(zero == ((Ticks_t) (task30->timerStartTime - task47 + 0xFAu) % 0x64u));
+  task04 = null;
+  unit_try(OK(xTaskGetTaskRunTimeStats(task29, &task04)));
+  unit_try(null != task04);
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+    unit_try(0x1u == task04->releases);
+    unit_try(0x4u <= task04->overruns);
+    unit_try(0x190u <= task04->maximumReleaseJitter);
+    unit_try(task04->maximumReleaseJitter == task04->totalReleaseJitter);
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+  unit_try(OK(xMemFree(task04)));
+  task04 = null;
+  unit_try(OK(xTaskGetTaskRunTimeStats(task30, &task04)));
+  unit_try(null != task04);
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+    unit_try(0x1u == task04->overruns);
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+  unit_try(OK(xMemFree(task04)));
+  unit_end();
+  unit_begin("xTaskGetReleasePolicy()");
+  unit_try(OK(xTaskGetReleasePolicy(task29, &task50)));
+  unit_try(TaskReleasePolicySkip == task50);
+  unit_try(OK(xTaskCreate(&task31, (Byte_t *) "TASK31", task_harness_task3, null)));
+  unit_try(OK(xTaskGetReleasePolicy(task31, &task50)));
+  unit_try(TaskReleasePolicyRelative == task50);
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(OK(xTaskDelete(task30)));
+  unit_try(OK(xTaskDelete(task31)));
+  unit_end();
+  unit_begin("Unit test for first task timer release");
+  task52 = zero;
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task52)));
+
+
+  /* The task timer is never reset so it has to start when the period is
+   * set, not when the system started. */
+  task47 = __PortGetSysTicks__();
+  unit_try(OK(xTaskChangePeriod(task29, 0x32u)));
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task52);
+  unit_try(0x32u <= (Ticks_t) (__PortGetSysTicks__() - task47));
+  task04 = null;
+  unit_try(OK(xTaskGetTaskRunTimeStats(task29, &task04)));
+  unit_try(null != task04);
+  unit_try(zero == task04->deadlineMisses);
+#if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+    unit_try(0x1u == task04->releases);
+    unit_try(0x32u > task04->maximumReleaseJitter);
+#endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+  unit_try(OK(xMemFree(task04)));
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+    unit_try(OK(xTaskGetLatencyHistogram(task29, TaskHistogramWakeLatency, &task51)));
+    unit_try(null != task51);
+    unit_try(0x1u == task51->count);
+    unit_try(0x32u > task51->maximum);
+    unit_try(OK(xMemFree(task51)));
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+  unit_try(OK(xTaskDelete(task29)));
+  task52 = zero;
+  unit_end();
+  unit_begin("xTaskGetLatencyHistogram()");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task52)));
+  unit_try(OK(xTaskCreate(&task30, (Byte_t *) "TASK30", task_harness_task3, &task53)));
+  unit_try(OK(xTaskChangePeriod(task29, 0x64u)));
+  task47 = __PortGetSysTicks__();
+  task29->timerStartTime = task47 - 0x1F4u;
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskWait(task30)));
+  unit_try(OK(xTaskNotifyGive(task30, 0x7, (Byte_t *) "MESSAGE")));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task52);
+  unit_try(0x1u == task53);
+#if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+    unit_try(OK(xTaskGetLatencyHistogram(task29, TaskHistogramWakeLatency, &task51)));
+    unit_try(null != task51);
+    unit_try(0x1u == task51->count);
+    unit_try(0x190u <= task51->maximum);
+    unit_try(0x1u == task51->histogram[0x8u]);
+    unit_try(task51->maximum == task51->percentile99);
+    unit_try(OK(xMemFree(task51)));
+    unit_try(OK(xTaskGetLatencyHistogram(task29, TaskHistogramRunTime, &task51)));
+    unit_try(null != task51);
+    unit_try(0x1u == task51->count);
+    unit_try(OK(xMemFree(task51)));
+    unit_try(OK(xTaskGetLatencyHistogram(task30, TaskHistogramWakeLatency, &task51)));
+    unit_try(null != task51);
+    unit_try(0x1u == task51->count);
+    unit_try(0x64u > task51->maximum);
+    unit_try(OK(xMemFree(task51)));
+#else  /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+    unit_try(!OK(xTaskGetLatencyHistogram(task29, TaskHistogramWakeLatency, &task51)));
+#endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+  unit_try(OK(xTaskDelete(task29)));
+  unit_try(OK(xTaskDelete(task30)));
+  unit_end();
+  unit_begin("xTaskGetTrace()");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task56)));
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskNotifyGive(task29, 0x7, (Byte_t *) "MESSAGE")));
+#if defined(CONFIG_TRACE_ENABLE)
+    unit_try(OK(xTaskClearTrace()));
+    unit_try(!OK(xTaskGetTrace(&task54, &task55)));
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task56);
+  unit_try(OK(xTaskSuspend(task29)));
+  unit_try(OK(xTaskResume(task29)));
+#if defined(CONFIG_TRACE_ENABLE)
+    unit_try(OK(xTaskGetTrace(&task54, &task55)));
+    unit_try(null != task54);
+    unit_try(0x5u == task55);
+    unit_try(TraceEventWakeNotification == task54[0].event);
+    unit_try(TraceEventDispatchStart == task54[1].event);
+    unit_try(TraceEventDispatchEnd == task54[2].event);
+    unit_try(TraceEventSuspend == task54[3].event);
+    unit_try(TraceEventResume == task54[4].event);
+    unit_try(task29->id == task54[0].id);
+    unit_try(task29->id == task54[4].id);
+    unit_try(task54[1].time <= task54[2].time);
+    unit_try(OK(xMemFree(task54)));
+    unit_try(OK(xTaskClearTrace()));
+    unit_try(!OK(xTaskGetTrace(&task54, &task55)));
+#else  /* if defined(CONFIG_TRACE_ENABLE) */
+    unit_try(!OK(xTaskGetTrace(&task54, &task55)));
+    unit_try(!OK(xTaskClearTrace()));
+#endif /* if defined(CONFIG_TRACE_ENABLE) */
+  unit_try(OK(xTaskDelete(task29)));
+  unit_end();
+  unit_begin("xTaskSetIdleHook()");
+  task_harness_idle = zero;
+  task38 = zero;
+  unit_try(OK(xTaskGetIdleTime(&task40)));
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task38)));
+  unit_try(OK(xTaskChangePeriod(task29, 0xC8u)));
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskResetTimer(task29)));
+  unit_try(OK(xTaskSetIdleHook(task_harness_idle_hook)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task38);
+  unit_try(zero < task_harness_idle);
+  unit_try(OK(xTaskSetIdleHook(null)));
+  unit_try(OK(xTaskDelete(task29)));
+  unit_end();
+  unit_begin("xTaskGetIdleTime()");
+  unit_try(OK(xTaskGetIdleTime(&task41)));
+  unit_try(zero < (task41 - task40));
+  unit_try(OK(xTaskGetCoreIdleTime(zero, &task40)));
+  unit_try(task41 == task40);
+  unit_try(!OK(xTaskGetCoreIdleTime(CONFIG_SCHEDULER_CORES, &task40)));
+  unit_try(!OK(xTaskGetCoreIdleTime(zero, null)));
+  unit_end();
+  unit_begin("xTaskGetUtilization()");
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task5, null)));
+  unit_try(OK(xTaskResume(task29)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+    unit_try(OK(xTaskGetUtilization(task29, &task57)));
+    unit_try(0x384u <= task57);
+    unit_try(0x3E8u >= task57);
+    unit_try(OK(xTaskGetIdleUtilization(&task57)));
+    unit_try(0x64u > task57);
+    unit_try(OK(xTaskGetTaskInfo(task29, &task58)));
+    unit_try(0x384u <= task58->utilization);
+    unit_try(OK(xMemFree(task58)));
+#else  /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+    unit_try(!OK(xTaskGetUtilization(task29, &task57)));
+    unit_try(!OK(xTaskGetIdleUtilization(&task57)));
+    unit_try(OK(xTaskGetTaskInfo(task29, &task58)));
+    unit_try(zero == task58->utilization);
+    unit_try(OK(xMemFree(task58)));
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+  unit_try(OK(xTaskDelete(task29)));
+  unit_end();
+  unit_begin("xTaskGetIdleUtilization()");
+  task38 = zero;
+  unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task38)));
+  unit_try(OK(xTaskChangePeriod(task29, 0x44Cu)));
+  unit_try(OK(xTaskWait(task29)));
+  unit_try(OK(xTaskResetTimer(task29)));
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task38);
+#if defined(CONFIG_TASK_UTILIZATION_ENABLE)
+    unit_try(OK(xTaskGetIdleUtilization(&task57)));
+    unit_try(0x384u <= task57);
+    unit_try(OK(xTaskGetUtilization(task29, &task57)));
+    unit_try(0x64u > task57);
+#endif /* if defined(CONFIG_TASK_UTILIZATION_ENABLE) */
+  unit_try(OK(xTaskDelete(task29)));
+  unit_end();
+  unit_begin("xTaskCreateStatic()");
+  task62 = null;
+  task64 = zero;
+  unit_try(OK(xSystemGetStaticSize(StaticObjectTask, &task65)));
+  unit_try(sizeof(task_harness_storage) > task65);
+  unit_try(OK(xMemGetKernelStats(&task62)));
+  task67 = task62->successfulAllocations;
+  unit_try(OK(xMemFree(task62)));
+  unit_try(!OK(xTaskCreateStatic(&task66, task_harness_storage + 0x3u, task65 - 0x1u, (Byte_t *) "STATIC01", task_harness_task7, &task64)));
+  unit_try(OK(xTaskCreateStatic(&task66, task_harness_storage + 0x3u, task65, (Byte_t *) "STATIC01", task_harness_task7, &task64)));
+  unit_try(OK(xMemGetKernelStats(&task62)));
+  unit_try(task67 == task62->successfulAllocations);
+  unit_try(OK(xMemFree(task62)));
+  task01 = null;
+  unit_try(OK(xTaskGetHandleByName(&task01, (Byte_t *) "STATIC01")));
+  unit_try(task66 == task01);
+
+
+  /* The task deletes itself while the scheduler is running so its storage is
+   * given back by the scheduler rather than by xTaskDelete(). */
+  unit_try(OK(xTaskResume(task66)));
+
+#if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE)
+
+    /* Nor is the ready heap grown from the kernel memory region when the task
+     * is resumed. */
+    unit_try(OK(xMemGetKernelStats(&task62)));
+    unit_try(task67 == task62->successfulAllocations);
+    unit_try(OK(xMemFree(task62)));
+#endif /* if defined(CONFIG_TASK_STATIC_HEAPS_ENABLE) */
+  unit_try(OK(xTaskResumeAll()));
+  unit_try(OK(xTaskStartScheduler()));
+  unit_try(0x1u == task64);
+  unit_try(!OK(xTaskResume(task66)));
+  unit_try(OK(xTaskCreateStatic(&task66, task_harness_storage + 0x3u, task65, (Byte_t *) "STATIC02", task_harness_task7, &task64)));
+  unit_try(OK(xTaskDelete(task66)));
+  unit_try(!OK(xTaskGetHandleByName(&task01, (Byte_t *) "STATIC02")));
+  unit_end();
+  unit_begin("Unit test for task heap growth");
+
+  /* Make each task periodic as soon as it is created so the timer heap grows
+   * along with the tasks. It must not be reallocated for every one of
+   * them. */
+  __memset__(task60, 'G', CONFIG_TASK_NAME_BYTES);
+  unit_try(OK(xMemGetKernelStats(&task62)));
+  task67 = task62->successfulAllocations;
+  unit_try(OK(xMemFree(task62)));
+
+  for(task61 = zero; task61 < (0x10u); task61++) {
+    task60[0] = (Byte_t) ('A' + task61);
+    unit_try(OK(xTaskCreate(&task59[task61], task60, task_harness_task, null)));
+    unit_try(OK(xTaskChangePeriod(task59[task61], 0x3E8u)));
+    unit_try(OK(xTaskWait(task59[task61])));
+  }
+
+  unit_try(OK(xMemGetKernelStats(&task62)));
+  unit_try((task67 + 0x10u + 0x3u) >= task62->successfulAllocations);
+  unit_try(OK(xMemFree(task62)));
+
+  for(task61 = zero; task61 < (0x10u); task61++) {
+    unit_try(OK(xTaskDelete(task59[task61])));
+  }
+
+  unit_end();
+#if defined(CONFIG_TASK_AWAIT_ENABLE)
+    unit_begin("Unit test for tasks that await kernel events");
+    task_harness_step = zero;
+    task_harness_runs = zero;
+    unit_try(OK(xQueueCreate(&task_harness_queue, 0x5u)));
+    unit_try(OK(xStreamCreate(&task_harness_stream)));
+    unit_try(OK(xTaskCreate(&task_harness_coroutine, (Byte_t *) "AWAITING", task_harness_task8, null)));
+    unit_try(OK(xTaskResume(task_harness_coroutine)));
+    unit_try(OK(xTaskSetIdleHook(task_harness_idle_hook2)));
+    unit_try(OK(xTaskResumeAll()));
+    unit_try(OK(xTaskStartScheduler()));
+
+
+    /* The task is only run once to start and once more for each event it
+     * awaited. The first byte sent to the stream buffer must not have woken
+     * it. */
+    unit_try(0x5u == task_harness_step);
+    unit_try(0x5u == task_harness_runs);
+    unit_try(OK(xTaskGetAwaitPoint(task_harness_coroutine, &task68)));
+    unit_try(zero == task68);
+    unit_try(OK(xTaskGetPeriod(task_harness_coroutine, &task40)));
+    unit_try(zero == task40);
+    unit_try(OK(xTaskSetIdleHook(null)));
+    unit_try(OK(xTaskDelete(task_harness_coroutine)));
+    unit_try(OK(xQueueDelete(task_harness_queue)));
+    unit_try(OK(xStreamDelete(task_harness_stream)));
+    unit_end();
+#endif /* if defined(CONFIG_TASK_AWAIT_ENABLE) */
+
+#if defined(CONFIG_TASK_STACKFUL_ENABLE)
+    unit_begin("xTaskCreateStackful()");
+    task_harness_step = zero;
+    task_harness_delayed = zero;
+    task_harness_received = zero;
+    task_harness_state = TaskStateSuspended;
+    unit_try(!OK(xTaskCreateStackful(&task_harness_coroutine, (Byte_t *) "STACKFUL", task_harness_task9, null, 0x100u)));
+    unit_try(OK(xQueueCreate(&task_harness_queue, 0x5u)));
+    unit_try(OK(xTaskCreateStackful(&task_harness_coroutine, (Byte_t *) "STACKFUL", task_harness_task9, null, 0x4000u)));
+    unit_try(OK(xTaskResume(task_harness_coroutine)));
+    unit_try(OK(xTaskSetIdleHook(task_harness_idle_hook3)));
+    unit_try(OK(xTaskResumeAll()));
+    unit_try(OK(xTaskStartScheduler()));
+
+
+    /* The task blocked twice in the middle of its main function and carried
+     * on each time with its locals intact. */
+    unit_try(0x3u == task_harness_step);
+    unit_try(0x32u <= task_harness_delayed);
+    unit_try(0x42u == task_harness_received);
+    unit_try(TaskStateRunning == task_harness_state);
+
+
+    /* Only a stackful task can block. */
+    unit_try(!OK(xTaskDelay(0x1u)));
+    unit_try(!OK(xQueueReceiveBlocking(task_harness_queue, &task69)));
+    unit_try(OK(xTaskSetIdleHook(null)));
+    unit_try(OK(xTaskDelete(task_harness_coroutine)));
+    unit_try(OK(xQueueDelete(task_harness_queue)));
+    unit_end();
+#endif /* if defined(CONFIG_TASK_STACKFUL_ENABLE) */
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    unit_begin("xTaskStartSchedulerThreads()");
+    task_harness_runs = zero;
+    task_harness_overlaps = zero;
+    unit_try(!OK(xTaskStartSchedulerThreads(zero)));
+    unit_try(!OK(xTaskStartSchedulerThreads(CONFIG_SCHEDULER_THREADS_MAXIMUM + 1)));
+    unit_try(OK(xMemGetUsed(&task72)));
+    unit_try(OK(xQueueCreate(&task_harness_queue, 0x40u)));
+    unit_try(OK(xTaskCreate(&task_harness_coroutine, (Byte_t *) "COLLECTS", task_harness_task11, null)));
+    unit_try(OK(xTaskResume(task_harness_coroutine)));
+
+    for(task71 = zero; task71 < 0x4u; task71++) {
+      task_harness_busy[task71] = false;
+      task_harness_count[task71] = zero;
+      task_harness_sent[task71] = zero;
+      unit_try(OK(xTaskCreate(&task70[task71], (Byte_t *) "THREADED", task_harness_task10, &task_harness_index[task71])));
+      unit_try(OK(xTaskResume(task70[task71])));
+    }
+
+    unit_try(OK(xTaskResumeAll()));
+    unit_try(OK(xTaskStartSchedulerThreads(0x4u)));
+
+
+    /* No task was ever run by two threads at once and every message sent from
+     * the threads was either received or is still waiting. */
+    unit_try(zero == task_harness_overlaps);
+    unit_try(OK(xQueueGetLength(task_harness_queue, &task74)));
+    task71 = task_harness_sent[0] + task_harness_sent[1] + task_harness_sent[2] + task_harness_sent[3];
+    unit_try(task71 == (task_harness_runs + task74));
+    unit_try(0x64u == task_harness_count[0]);
+    unit_try(0x64u == task_harness_count[3]);
+
+    for(task71 = zero; task71 < 0x4u; task71++) {
+      unit_try(OK(xTaskDelete(task70[task71])));
+    }
+
+    unit_try(OK(xTaskDelete(task_harness_coroutine)));
+    unit_try(OK(xQueueDelete(task_harness_queue)));
+    unit_try(OK(xMemGetUsed(&task73)));
+    unit_try(task72 == task73);
+    unit_end();
+    unit_begin("Unit test for task timers with more than one thread");
+    task52 = zero;
+    unit_try(OK(xTaskCreate(&task29, (Byte_t *) "TASK29", task_harness_task3, &task52)));
+    unit_try(OK(xTaskChangePeriod(task29, 0x64u)));
+    task47 = __PortGetSysTicks__();
+    task29->timerStartTime = task47 - 0x1F4u;
+    unit_try(OK(xTaskWait(task29)));
+    unit_try(OK(xTaskResumeAll()));
+    unit_try(OK(xTaskStartSchedulerThreads(0x2u)));
+    unit_try(0x1u == task52);
+
+
+    /* The task timer is only restarted once the thread has run the task. */
+    unit_try(0x64u >= (Ticks_t) (__PortGetSysTicks__() - task29->timerStartTime));
+  #if defined(CONFIG_TASK_HISTOGRAM_ENABLE)
+      unit_try(OK(xTaskGetLatencyHistogram(task29, TaskHistogramWakeLatency, &task51)));
+      unit_try(null != task51);
+      unit_try(0x1u == task51->count);
+      unit_try(0x190u <= task51->maximum);
+      unit_try(0x1000u > task51->maximum);
+      unit_try(OK(xMemFree(task51)));
+  #endif /* if defined(CONFIG_TASK_HISTOGRAM_ENABLE) */
+  #if defined(CONFIG_TASK_RELEASE_STATS_ENABLE)
+      task04 = null;
+      unit_try(OK(xTaskGetTaskRunTimeStats(task29, &task04)));
+      unit_try(null != task04);
+      unit_try(0x1u == task04->releases);
+      unit_try(0x1u == task04->deadlineMisses);
+      unit_try(0x190u <= task04->maximumReleaseJitter);
+      unit_try(0x1000u > task04->maximumReleaseJitter);
+      unit_try(OK(xMemFree(task04)));
+  #endif /* if defined(CONFIG_TASK_RELEASE_STATS_ENABLE) */
+    unit_try(OK(xTaskDelete(task29)));
+    unit_end();
+  #if CONFIG_SCHEDULER_CORES > 0x3u
+      unit_begin("xTaskStartSchedulerCores()");
+      unit_try(OK(xMemGetUsed(&task72)));
+      unit_try(OK(xTaskCreate(&task_harness_pinned[0], (Byte_t *) "PRODUCER", task_harness_task12, &task_harness_index[0])));
+      unit_try(OK(xTaskResume(task_harness_pinned[0])));
+
+      for(task71 = 1; task71 < 0x4u; task71++) {
+        unit_try(OK(xTaskCreate(&task_harness_pinned[task71], (Byte_t *) "CONSUMER", task_harness_task13, &task_harness_index[task71])));
+        unit_try(OK(xTaskWait(task_harness_pinned[task71])));
+        unit_try(OK(xTaskSetAffinity(task_harness_pinned[task71], (Base_t) task71)));
+      }
+
+      for(task71 = zero; task71 < 0x4u; task71++) {
+        task_harness_count[task71] = zero;
+        task_harness_sent[task71] = zero;
+        task_harness_cores[task71] = zero;
+        unit_try(OK(xTaskGetAffinity(task_harness_pinned[task71], &task74)));
+        unit_try(task71 == task74);
+      }
+
+      unit_try(!OK(xTaskSetAffinity(task_harness_pinned[1], CONFIG_SCHEDULER_CORES)));
+      unit_try(!OK(xTaskStartSchedulerCores(zero)));
+      unit_try(!OK(xTaskStartSchedulerCores(CONFIG_SCHEDULER_CORES + 1)));
+      unit_try(OK(xTaskSetIdleHook(task_harness_idle_hook4)));
+      unit_try(OK(xTaskResumeAll()));
+      unit_try(OK(xTaskGetCoreIdleTime(zero, &task40)));
+      task47 = __PortGetSysTicks__();
+      unit_try(OK(xTaskStartSchedulerCores(0x4u)));
+      task47 = __PortGetSysTicks__() - task47;
+
+
+      /* Each core only counts its own idle time so none of them can have been
+       * idle for longer than the cores ran. */
+      unit_try(OK(xTaskGetCoreIdleTime(zero, &task41)));
+      unit_try(task47 >= (task41 - task40));
+
+      for(task71 = 0x1u; task71 < 0x4u; task71++) {
+        unit_try(OK(xTaskGetCoreIdleTime((Base_t) task71, &task41)));
+        unit_try(task47 >= task41);
+      }
+
+
+      /* Every task was only ever run by the core it was pinned to and every
+       * notification given across cores was taken. */
+      unit_try(0x12Cu == task_harness_sent[0]);
+
+      for(task71 = zero; task71 < 0x4u; task71++) {
+        unit_try(((Word_t) 1u << task71) == task_harness_cores[task71]);
+      }
+
+      unit_try(0x64u == task_harness_count[1]);
+      unit_try(0x64u == task_harness_count[2]);
+      unit_try(0x64u == task_harness_count[3]);
+      unit_try(OK(xTaskSetIdleHook(null)));
+
+      for(task71 = zero; task71 < 0x4u; task71++) {
+        unit_try(OK(xTaskDelete(task_harness_pinned[task71])));
+      }
+
+      unit_try(OK(xMemGetUsed(&task73)));
+      unit_try(task72 == task73);
+      unit_end();
+  #endif /* if CONFIG_SCHEDULER_CORES > 0x3u */
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
 
   return;
 }
@@ -237,4 +1082,287 @@ void task_harness_task2(Task_t *task_, TaskParm_t *parm_) {
   xTaskSuspendAll();
 
   return;
-}
\ No newline at end of file
+}
+
+
+void task_harness_task3(Task_t *task_, TaskParm_t *parm_) {
+  (*((Base_t *) parm_))++;
+  xTaskSuspendAll();
+
+  return;
+}
+
+
+void task_harness_task4(Task_t *task_, TaskParm_t *parm_) {
+  task_harness_sequence++;
+  *((Base_t *) parm_) = task_harness_sequence;
+  xTaskSuspendAll();
+
+  return;
+}
+
+
+void task_harness_task5(Task_t *task_, TaskParm_t *parm_) {
+  Ticks_t start = zero;
+
+
+  /* Keep the CPU busy for longer than the utilization window. */
+  start = __PortGetSysTicks__();
+
+  while(0x44Cu > (__PortGetSysTicks__() - start)) {
+  }
+
+  xTaskSuspendAll();
+
+  return;
+}
+
+
+void task_harness_task6(Task_t *task_, TaskParm_t *parm_) {
+  /* Start a worker then get out of the way. */
+  if(OK(xTaskCreate(&task_harness_worker, (Byte_t *) "WORKER", task_harness_task7, parm_))) {
+    xTaskResume(task_harness_worker);
+  }
+
+  xTaskSuspend(task_);
+
+  return;
+}
+
+
+void task_harness_task7(Task_t *task_, TaskParm_t *parm_) {
+  (*((Base_t *) parm_))++;
+  xTaskDelete(task_);
+  xTaskSuspendAll();
+
+  return;
+}
+
+
+void task_harness_task8(Task_t *task_, TaskParm_t *parm_) {
+  task_harness_runs++;
+  TASK_AWAIT_BEGIN(task_);
+  task_harness_step = 0x1u;
+  TASK_AWAIT_NOTIFICATION(task_);
+  xTaskNotifyStateClear(task_);
+  task_harness_step = 0x2u;
+  TASK_AWAIT_QUEUE(task_, task_harness_queue);
+  xQueueDropMessage(task_harness_queue);
+  task_harness_step = 0x3u;
+  TASK_AWAIT_STREAM(task_, task_harness_stream, 0x2u);
+  task_harness_step = 0x4u;
+  TASK_AWAIT_PERIOD(task_, 0x64u);
+  task_harness_step = 0x5u;
+  xTaskSuspendAll();
+  TASK_AWAIT_END(task_);
+
+  return;
+}
+
+
+void task_harness_idle_hook2(void) {
+  HalfWord_t bytes = zero;
+
+
+  /* Stand in for an interrupt handler that produces whatever the awaiting
+   * task is waiting on. */
+  if(0x1u == task_harness_step) {
+    xTaskNotifyGive(task_harness_coroutine, 0x1u, (Byte_t *) "A");
+  } else if(0x2u == task_harness_step) {
+    xQueueSend(task_harness_queue, 0x1u, (Byte_t *) "A");
+  } else if((0x3u == task_harness_step) && (OK(xStreamBytesAvailable(task_harness_stream, &bytes)))) {
+    xStreamSend(task_harness_stream, 0x2u);
+  } else if(0x3u == task_harness_step) {
+    xStreamSend(task_harness_stream, 0x1u);
+  }
+
+  return;
+}
+
+
+void task_harness_task9(Task_t *task_, TaskParm_t *parm_) {
+  Ticks_t start = zero;
+  QueueMessage_t *message = null;
+
+
+  task_harness_step = 0x1u;
+  start = __PortGetSysTicks__();
+
+  if(OK(xTaskDelay(0x32u))) {
+    task_harness_delayed = __PortGetSysTicks__() - start;
+  }
+
+  task_harness_step = 0x2u;
+
+  if(OK(xQueueReceiveBlocking(task_harness_queue, &message))) {
+    task_harness_received = message->messageValue[0];
+    xMemFree(message);
+  }
+
+  /* Blocking must have left the task in the state it was in. */
+  xTaskGetTaskState(task_, &task_harness_state);
+  task_harness_step = 0x3u;
+  xTaskSuspend(task_);
+  xTaskSuspendAll();
+
+  return;
+}
+
+
+void task_harness_idle_hook3(void) {
+  /* The stackful task is blocked on the message queue so send it a message.
+   */
+  if(0x2u == task_harness_step) {
+    xQueueSend(task_harness_queue, 0x1u, (Byte_t *) "B");
+  }
+
+  return;
+}
+
+
+void task_harness_task10(Task_t *task_, TaskParm_t *parm_) {
+  Base_t index = zero;
+  volatile Addr_t *addr = null;
+
+
+  index = DEREF_TASKPARM(Base_t, parm_);
+
+  if(true == task_harness_busy[index]) {
+    task_harness_overlaps++;
+  }
+
+  task_harness_busy[index] = true;
+
+  if(OK(xMemAlloc(&addr, 0x20u))) {
+    xMemFree(addr);
+  }
+
+  if(OK(xQueueSend(task_harness_queue, 0x1u, (Byte_t *) "C"))) {
+    task_harness_sent[index]++;
+  }
+
+  task_harness_count[index]++;
+
+  if(0x64u <= task_harness_count[index]) {
+    xTaskSuspend(task_);
+  }
+
+  task_harness_busy[index] = false;
+
+  return;
+}
+
+
+void task_harness_task11(Task_t *task_, TaskParm_t *parm_) {
+  QueueMessage_t *message = null;
+
+
+  while(OK(xQueueReceive(task_harness_queue, &message))) {
+    xMemFree(message);
+    task_harness_runs++;
+  }
+
+
+  /* Stop the scheduler once every other task has been run enough. */
+  if((0x64u <= task_harness_count[0]) && (0x64u <= task_harness_count[1]) && (0x64u <= task_harness_count[2]) && (0x64u <= task_harness_count[3])) {
+    xTaskSuspendAll();
+  }
+
+  return;
+}
+
+
+void task_harness_idle_hook(void) {
+  task_harness_idle++;
+
+  return;
+}
+
+
+#if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+
+
+  /* Runs on core zero and hands out notifications to the tasks pinned to the
+   * other cores in turn. */
+  void task_harness_task12(Task_t *task_, TaskParm_t *parm_) {
+    Base_t index = zero;
+    Base_t waiting = zero;
+
+
+    task_harness_cores[0] |= ((Word_t) 1u << __PortCoreGet__());
+    index = (Base_t) (1 + (task_harness_sent[0] % 0x3u));
+
+    if(OK(xTaskNotificationIsWaiting(task_harness_pinned[index], &waiting)) && (false == waiting)) {
+      if(OK(xTaskNotifyGive(task_harness_pinned[index], 0x1u, (Byte_t *) "N"))) {
+        task_harness_sent[0]++;
+      }
+    }
+
+    if(0x12Cu <= task_harness_sent[0]) {
+      xTaskSuspend(task_);
+    }
+
+    return;
+  }
+
+
+  void task_harness_task13(Task_t *task_, TaskParm_t *parm_) {
+    Base_t index = zero;
+    TaskNotification_t *notification = null;
+
+
+    index = DEREF_TASKPARM(Base_t, parm_);
+    task_harness_cores[index] |= ((Word_t) 1u << __PortCoreGet__());
+
+    if(OK(xTaskNotifyTake(task_, &notification))) {
+      xMemFree(notification);
+      task_harness_count[index]++;
+    }
+
+    if(0x64u <= task_harness_count[index]) {
+      xTaskSuspend(task_);
+    }
+
+    return;
+  }
+
+
+  /* Each core suspends its own scheduler instance once every pinned task has
+   * suspended itself. */
+  void task_harness_idle_hook4(void) {
+    Base_t index = zero;
+    Base_t done = true;
+    TaskState_t state = TaskStateSuspended;
+
+
+    for(index = zero; index < 0x4u; index++) {
+      if(!OK(xTaskGetTaskState(task_harness_pinned[index], &state)) || (TaskStateSuspended != state)) {
+        done = false;
+      }
+    }
+
+    if(true == done) {
+      xTaskSuspendAll();
+    }
+
+    return;
+  }
+
+
+#endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+
+
+void task_harness_task14(Task_t *task_, TaskParm_t *parm_) {
+  Word_t count = zero;
+  Word_t bits = zero;
+
+
+  if(OK(xTaskNotifyTakeCount(task_, &count)) && OK(xTaskNotifyTakeBits(task_, &bits))) {
+    task_harness_taken += count;
+    task_harness_bits |= bits;
+  }
+
+  xTaskSuspendAll();
+
+  return;
+}
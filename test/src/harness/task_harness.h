@@ -37,6 +37,25 @@
   void task_harness(void);
   void task_harness_task(Task_t *task_, TaskParm_t *parm_);
   void task_harness_task2(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_task3(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_task4(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_task5(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_task6(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_task7(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_task8(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_idle_hook(void);
+  void task_harness_task9(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_idle_hook2(void);
+  void task_harness_task10(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_task11(Task_t *task_, TaskParm_t *parm_);
+  void task_harness_idle_hook3(void);
+
+  #if defined(CONFIG_SCHEDULER_THREADS_ENABLE)
+    void task_harness_task12(Task_t *task_, TaskParm_t *parm_);
+    void task_harness_task13(Task_t *task_, TaskParm_t *parm_);
+    void task_harness_idle_hook4(void);
+  #endif /* if defined(CONFIG_SCHEDULER_THREADS_ENABLE) */
+  void task_harness_task14(Task_t *task_, TaskParm_t *parm_);
 
   #ifdef __cplusplus
     }
@@ -17,6 +17,9 @@
 #include "timer_harness.h"
 
 
+static Byte_t timer_harness_storage[0x40];
+
+
 void timer_harness(void) {
   Timer_t *timer01 = null;
   Ticks_t timer02 = zero;
@@ -28,6 +31,7 @@ void timer_harness(void) {
   Base_t timer08 = zero;
   Base_t timer09 = zero;
   Ticks_t timer10 = zero;
+  Size_t timer11 = zero;
 
 
   unit_begin("xTimerCreate()");
@@ -78,6 +82,21 @@ void timer_harness(void) {
   unit_try(OK(xTimerDelete(timer01)));
   unit_try(!OK(xTimerGetPeriod(timer01, &timer10)));
   unit_end();
+  unit_begin("xTimerCreateStatic()");
+  timer01 = null;
+  unit_try(OK(xSystemGetStaticSize(StaticObjectTimer, &timer11)));
+  unit_try(sizeof(timer_harness_storage) >= timer11);
+  unit_try(!OK(xTimerCreateStatic(&timer01, timer_harness_storage, timer11 - 0x1u, 0x3E8)));
+  unit_try(OK(xTimerCreateStatic(&timer01, timer_harness_storage, timer11, 0x3E8)));
+  unit_try(null != timer01);
+  unit_try(OK(xTimerGetPeriod(timer01, &timer10)));
+  unit_try(0x3E8 == timer10);
+  unit_try(OK(xTimerStart(timer01)));
+  unit_try(OK(xTimerIsTimerActive(timer01, &timer08)));
+  unit_try(true == timer08);
+  unit_try(OK(xTimerDelete(timer01)));
+  unit_try(!OK(xTimerGetPeriod(timer01, &timer10)));
+  unit_end();
 
   return;
 }
\ No newline at end of file
@@ -0,0 +1,373 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file memmap.c
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Host tool for rendering memory region maps
+ * @version 0.4.1
+ * @date 2023-03-19
+ * 
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *  
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  
+ * 
+ */
+/*UNCRUSTIFY-ON*/
+
+
+/*UNCRUSTIFY-OFF*/
+/*
+ * The memmap tool reads a memory region map captured with xMemGetRegionMap()
+ * and renders it as text or SVG along with fragmentation metrics. It runs on
+ * the host, not the target, and is built on its own:
+ *
+ *   gcc -ansi -pedantic -Wall -Wextra -o test/bin/memmap test/tools/memmap.c
+ *
+ * The input is one memory entry per line in the form "offset blocks free",
+ * where offset and blocks are in blocks and free is 1 for a free entry and 0
+ * for an in-use entry. Blank lines and lines starting with '#' are ignored.
+ * On the target, a capture can be produced with something like:
+ *
+ *   if(OK(xMemGetRegionMap(MemoryRegionHeap, map, 64, &entries))) {
+ *     for(i = 0; (i < entries) && (i < 64); i++) {
+ *       printf("%u %u %u\n", map[i].offset, map[i].blocks, map[i].free ? 1 : 0);
+ *     }
+ *   }
+ *
+ * Usage:
+ *
+ *   memmap [-f text|svg] [-b block size in bytes] [-w width] [file]
+ *
+ * If no file is given, the map is read from standard input.
+ */
+/*UNCRUSTIFY-ON*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#if defined(MEMMAP_MAX_ENTRIES)
+  #undef MEMMAP_MAX_ENTRIES
+#endif /* if defined(MEMMAP_MAX_ENTRIES) */
+#define MEMMAP_MAX_ENTRIES 0x10000 /* 65536 */
+
+
+#if defined(MEMMAP_LINE_LENGTH)
+  #undef MEMMAP_LINE_LENGTH
+#endif /* if defined(MEMMAP_LINE_LENGTH) */
+#define MEMMAP_LINE_LENGTH 0x100 /* 256 */
+
+
+#if defined(MEMMAP_SVG_ROW_BLOCKS)
+  #undef MEMMAP_SVG_ROW_BLOCKS
+#endif /* if defined(MEMMAP_SVG_ROW_BLOCKS) */
+#define MEMMAP_SVG_ROW_BLOCKS 0x40 /* 64 */
+
+
+typedef struct MapEntry_s {
+  unsigned long offset;
+  unsigned long blocks;
+  int free;
+} MapEntry_t;
+typedef struct MapMetrics_s {
+  unsigned long entries;
+  unsigned long freeEntries;
+  unsigned long totalBlocks;
+  unsigned long usedBlocks;
+  unsigned long freeBlocks;
+  unsigned long largestFree;
+  unsigned long smallestFree;
+  unsigned long gaps;
+  double fragmentation;
+} MapMetrics_t;
+
+
+static MapEntry_t entries[MEMMAP_MAX_ENTRIES];
+static int readMap(FILE *in_, unsigned long *count_);
+static void computeMetrics(const unsigned long count_, MapMetrics_t *metrics_);
+static void printMetrics(const MapMetrics_t *metrics_, const unsigned long blockSize_);
+static void renderText(const unsigned long count_, const MapMetrics_t *metrics_, const unsigned long width_);
+static void renderSvg(const unsigned long count_, const MapMetrics_t *metrics_, const unsigned long blockSize_);
+static void usage(void);
+
+
+int main(int argc, char **argv) {
+  int i;
+  int svg = 0;
+  unsigned long count = 0;
+  unsigned long blockSize = 0x20; /* 32 */
+  unsigned long width = 0x40; /* 64 */
+  FILE *in = stdin;
+  MapMetrics_t metrics;
+
+
+  for(i = 1; i < argc; i++) {
+    if((0 == strcmp("-f", argv[i])) && ((i + 1) < argc)) {
+      i++;
+
+      if(0 == strcmp("svg", argv[i])) {
+        svg = 1;
+      } else if(0 == strcmp("text", argv[i])) {
+        svg = 0;
+      } else {
+        usage();
+
+        return(1);
+      }
+    } else if((0 == strcmp("-b", argv[i])) && ((i + 1) < argc)) {
+      i++;
+      blockSize = strtoul(argv[i], NULL, 0);
+    } else if((0 == strcmp("-w", argv[i])) && ((i + 1) < argc)) {
+      i++;
+      width = strtoul(argv[i], NULL, 0);
+    } else if('-' == argv[i][0]) {
+      usage();
+
+      return(1);
+    } else {
+      in = fopen(argv[i], "r");
+
+      if(NULL == in) {
+        fprintf(stderr, "memmap: unable to open %s\n", argv[i]);
+
+        return(1);
+      }
+    }
+  }
+
+  if((0 == blockSize) || (0 == width)) {
+    usage();
+
+    return(1);
+  }
+
+  if(0 != readMap(in, &count)) {
+    return(1);
+  }
+
+  if(stdin != in) {
+    fclose(in);
+  }
+
+  computeMetrics(count, &metrics);
+
+  if(1 == svg) {
+    renderSvg(count, &metrics, blockSize);
+  } else {
+    printMetrics(&metrics, blockSize);
+    renderText(count, &metrics, width);
+  }
+
+  return(0);
+}
+
+
+static int readMap(FILE *in_, unsigned long *count_) {
+  char line[MEMMAP_LINE_LENGTH];
+  unsigned long offset;
+  unsigned long blocks;
+  unsigned long free;
+  unsigned long lineNo = 0;
+
+
+  *count_ = 0;
+
+  while(NULL != fgets(line, MEMMAP_LINE_LENGTH, in_)) {
+    lineNo++;
+
+    if(('#' == line[0]) || ('\n' == line[0]) || ('\r' == line[0]) || ('\0' == line[0])) {
+      continue;
+    }
+
+    if(3 != sscanf(line, "%lu %lu %lu", &offset, &blocks, &free)) {
+      fprintf(stderr, "memmap: malformed entry on line %lu\n", lineNo);
+
+      return(1);
+    }
+
+    if(MEMMAP_MAX_ENTRIES <= *count_) {
+      fprintf(stderr, "memmap: too many entries\n");
+
+      return(1);
+    }
+
+    entries[*count_].offset = offset;
+    entries[*count_].blocks = blocks;
+    entries[*count_].free = (0 != free) ? 1 : 0;
+    (*count_)++;
+  }
+
+  if(0 == *count_) {
+    fprintf(stderr, "memmap: no entries\n");
+
+    return(1);
+  }
+
+  return(0);
+}
+
+
+static void computeMetrics(const unsigned long count_, MapMetrics_t *metrics_) {
+  unsigned long i;
+
+
+  memset(metrics_, 0, sizeof(MapMetrics_t));
+  metrics_->entries = count_;
+
+  for(i = 0; i < count_; i++) {
+    /* A gap is any entry that does not start where the previous one ended. A
+     * consistent map has none, so anything here points at a bad capture. */
+    if((0 < i) && (entries[i].offset != (entries[i - 1].offset + entries[i - 1].blocks))) {
+      metrics_->gaps++;
+    }
+
+    metrics_->totalBlocks += entries[i].blocks;
+
+    if(1 == entries[i].free) {
+      metrics_->freeEntries++;
+      metrics_->freeBlocks += entries[i].blocks;
+
+      if(metrics_->largestFree < entries[i].blocks) {
+        metrics_->largestFree = entries[i].blocks;
+      }
+
+      if((0 == metrics_->smallestFree) || (metrics_->smallestFree > entries[i].blocks)) {
+        metrics_->smallestFree = entries[i].blocks;
+      }
+    } else {
+      metrics_->usedBlocks += entries[i].blocks;
+    }
+  }
+
+  /* External fragmentation is the share of free memory that cannot be handed
+   * out in a single allocation, 0.0 when all free memory is in one entry and
+   * approaching 1.0 as it is split into many small entries. */
+  if(0 < metrics_->freeBlocks) {
+    metrics_->fragmentation = 1.0 - ((double) metrics_->largestFree / (double) metrics_->freeBlocks);
+  }
+
+  return;
+}
+
+
+static void printMetrics(const MapMetrics_t *metrics_, const unsigned long blockSize_) {
+  printf("entries:             %lu (%lu free, %lu in-use)\n", metrics_->entries, metrics_->freeEntries, metrics_->entries - metrics_->freeEntries);
+  printf("total:               %lu blocks (%lu bytes)\n", metrics_->totalBlocks, metrics_->totalBlocks * blockSize_);
+  printf("in-use:              %lu blocks (%lu bytes)\n", metrics_->usedBlocks, metrics_->usedBlocks * blockSize_);
+  printf("free:                %lu blocks (%lu bytes)\n", metrics_->freeBlocks, metrics_->freeBlocks * blockSize_);
+  printf("largest free entry:  %lu blocks (%lu bytes)\n", metrics_->largestFree, metrics_->largestFree * blockSize_);
+  printf("smallest free entry: %lu blocks (%lu bytes)\n", metrics_->smallestFree, metrics_->smallestFree * blockSize_);
+
+  if(0 < metrics_->freeEntries) {
+    printf("average free entry:  %.1f blocks\n", (double) metrics_->freeBlocks / (double) metrics_->freeEntries);
+  }
+
+  printf("fragmentation:       %.3f\n", metrics_->fragmentation);
+
+  if(0 < metrics_->gaps) {
+    printf("warning:             %lu gap(s) between entries\n", metrics_->gaps);
+  }
+
+  return;
+}
+
+
+static void renderText(const unsigned long count_, const MapMetrics_t *metrics_, const unsigned long width_) {
+  unsigned long column;
+  unsigned long first;
+  unsigned long last;
+  unsigned long i;
+  int used;
+  int free;
+
+
+  /* Each column covers an equal share of the blocks. A column is '#' when all
+   * of its blocks are in-use, '.' when all of them are free and '+' when it
+   * straddles both. */
+  printf("\n");
+
+  for(column = 0; column < width_; column++) {
+    first = (column * metrics_->totalBlocks) / width_;
+    last = (((column + 1) * metrics_->totalBlocks) / width_);
+
+    if(last <= first) {
+      last = first + 1;
+    }
+
+    used = 0;
+    free = 0;
+
+    for(i = 0; i < count_; i++) {
+      if((entries[i].offset < last) && ((entries[i].offset + entries[i].blocks) > first)) {
+        if(1 == entries[i].free) {
+          free = 1;
+        } else {
+          used = 1;
+        }
+      }
+    }
+
+    if((1 == used) && (1 == free)) {
+      putchar('+');
+    } else if(1 == used) {
+      putchar('#');
+    } else {
+      putchar('.');
+    }
+  }
+
+  printf("\n");
+
+  return;
+}
+
+
+static void renderSvg(const unsigned long count_, const MapMetrics_t *metrics_, const unsigned long blockSize_) {
+  unsigned long i;
+  unsigned long block;
+  unsigned long end;
+  unsigned long run;
+  unsigned long rows;
+  unsigned long cell = 0xC; /* 12 */
+  unsigned long header = 0x30; /* 48 */
+
+
+  /* Blocks are laid out left to right, MEMMAP_SVG_ROW_BLOCKS to a row, with
+   * one rectangle per row segment of each memory entry. */
+  rows = (metrics_->totalBlocks + MEMMAP_SVG_ROW_BLOCKS - 1) / MEMMAP_SVG_ROW_BLOCKS;
+  printf("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%lu\" height=\"%lu\">\n", MEMMAP_SVG_ROW_BLOCKS * cell, header + (rows * cell));
+  printf("<style>text{font:12px monospace}.u{fill:#c0392b}.f{fill:#27ae60}rect{stroke:#fff;stroke-width:0.5}</style>\n");
+  printf("<text x=\"0\" y=\"14\">%lu entries, %lu of %lu bytes free, largest free %lu bytes</text>\n", metrics_->entries, metrics_->freeBlocks * blockSize_,
+    metrics_->totalBlocks * blockSize_, metrics_->largestFree * blockSize_);
+  printf("<text x=\"0\" y=\"32\">fragmentation %.3f</text>\n", metrics_->fragmentation);
+
+  for(i = 0; i < count_; i++) {
+    block = entries[i].offset;
+    end = entries[i].offset + entries[i].blocks;
+
+    while(block < end) {
+      run = MEMMAP_SVG_ROW_BLOCKS - (block % MEMMAP_SVG_ROW_BLOCKS);
+
+      if(run > (end - block)) {
+        run = end - block;
+      }
+
+      printf("<rect class=\"%s\" x=\"%lu\" y=\"%lu\" width=\"%lu\" height=\"%lu\"><title>offset %lu, %lu blocks, %s</title></rect>\n", (1 ==
+        entries[i].free) ? "f" : "u", (block % MEMMAP_SVG_ROW_BLOCKS) * cell, header + ((block / MEMMAP_SVG_ROW_BLOCKS) * cell), run * cell, cell,
+        entries[i].offset, entries[i].blocks, (1 == entries[i].free) ? "free" : "in-use");
+      block += run;
+    }
+  }
+
+  printf("</svg>\n");
+
+  return;
+}
+
+
+static void usage(void) {
+  fprintf(stderr, "usage: memmap [-f text|svg] [-b block size in bytes] [-w width] [file]\n");
+
+  return;
+}
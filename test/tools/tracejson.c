@@ -0,0 +1,247 @@
+/*UNCRUSTIFY-OFF*/
+/**
+ * @file tracejson.c
+ * @author Manny Peterson <manny@heliosproj.org>
+ * @brief Host tool for converting scheduler event traces to Chrome trace JSON
+ * @version 0.4.1
+ * @date 2023-03-19
+ *
+ * @copyright
+ * HeliOS Embedded Operating System Copyright (C) 2020-2023 HeliOS Project <license@heliosproj.org>
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ *
+ */
+/*UNCRUSTIFY-ON*/
+
+
+/*UNCRUSTIFY-OFF*/
+/*
+ * The tracejson tool reads a scheduler event trace captured with
+ * xTaskGetTrace() and writes it out in the Chrome trace event JSON format so
+ * it can be viewed as a timeline in chrome://tracing or the Perfetto UI
+ * (https://ui.perfetto.dev). It runs on the host, not the target, and is built
+ * on its own:
+ *
+ *   gcc -ansi -pedantic -Wall -Wextra -o test/bin/tracejson test/tools/tracejson.c
+ *
+ * The input is one trace event per line in the form "time id event", where
+ * time is in ticks, id is the task ID and event is the TraceEventType_t value.
+ * Lines in the form "task id name" give a task a name on the timeline. Blank
+ * lines and lines starting with '#' are ignored. On the target, a capture can
+ * be produced with something like:
+ *
+ *   if(OK(xTaskGetTrace(&events, &count))) {
+ *     for(i = 0; i < count; i++) {
+ *       printf("%lu %u %u\n", (unsigned long) events[i].time, events[i].id, events[i].event);
+ *     }
+ *
+ *     xMemFree(events);
+ *   }
+ *
+ * Each task is shown as its own thread. Dispatches become duration slices and
+ * everything else becomes an instant event on the task's thread. Because the
+ * trace buffer is a ring, a capture may start in the middle of a dispatch so a
+ * dispatch end without a matching start is dropped.
+ *
+ * Usage:
+ *
+ *   tracejson [-u microseconds per tick] [file]
+ */
+/*UNCRUSTIFY-ON*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#if defined(TRACEJSON_LINE_LENGTH)
+  #undef TRACEJSON_LINE_LENGTH
+#endif /* if defined(TRACEJSON_LINE_LENGTH) */
+#define TRACEJSON_LINE_LENGTH 0x80 /* 128 */
+
+
+#if defined(TRACEJSON_MAX_TASKS)
+  #undef TRACEJSON_MAX_TASKS
+#endif /* if defined(TRACEJSON_MAX_TASKS) */
+#define TRACEJSON_MAX_TASKS 0x100 /* 256 */
+
+
+#if defined(TRACEJSON_NAME_LENGTH)
+  #undef TRACEJSON_NAME_LENGTH
+#endif /* if defined(TRACEJSON_NAME_LENGTH) */
+#define TRACEJSON_NAME_LENGTH 0x20 /* 32 */
+
+
+/* These must be kept in the same order as TraceEventType_t in HeliOS.h. */
+typedef enum TraceEventType_e {
+  TraceEventDispatchStart,
+  TraceEventDispatchEnd,
+  TraceEventWakePeriod,
+  TraceEventWakeNotification,
+  TraceEventSuspend,
+  TraceEventResume,
+  TraceEventWDSuspend,
+  TraceEventWakeAwait,
+  TraceEventTypes
+} TraceEventType_t;
+typedef struct TraceTask_s {
+  char name[TRACEJSON_NAME_LENGTH];
+  int named;
+  int open;
+} TraceTask_t;
+
+
+static const char *eventNames[TraceEventTypes] = {
+  "dispatch", "dispatch", "wake (period)", "wake (notification)", "suspend", "resume", "watchdog suspend", "wake (await)"
+};
+static TraceTask_t tasks[TRACEJSON_MAX_TASKS];
+static unsigned long events = 0;
+static int convert(FILE *in_, const double scale_);
+static void emit(const char *name_, const char *phase_, const double ts_, const unsigned long id_);
+static void usage(void);
+
+
+int main(int argc, char **argv) {
+  int i;
+  int ret;
+  double scale = 1000.0; /* One tick is a millisecond by default. */
+  FILE *in = stdin;
+
+
+  for(i = 1; i < argc; i++) {
+    if((0 == strcmp("-u", argv[i])) && ((i + 1) < argc)) {
+      i++;
+      scale = strtod(argv[i], NULL);
+    } else if('-' == argv[i][0]) {
+      usage();
+
+      return(1);
+    } else {
+      in = fopen(argv[i], "r");
+
+      if(NULL == in) {
+        fprintf(stderr, "tracejson: unable to open %s\n", argv[i]);
+
+        return(1);
+      }
+    }
+  }
+
+  if(0.0 >= scale) {
+    usage();
+
+    return(1);
+  }
+
+  ret = convert(in, scale);
+
+  if(stdin != in) {
+    fclose(in);
+  }
+
+  return(ret);
+}
+
+
+static int convert(FILE *in_, const double scale_) {
+  char line[TRACEJSON_LINE_LENGTH];
+  char name[TRACEJSON_NAME_LENGTH];
+  unsigned long time;
+  unsigned long id;
+  unsigned long event;
+  unsigned long last = 0;
+  unsigned long lineNo = 0;
+
+
+  memset(tasks, 0, sizeof(tasks));
+  printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+  while(NULL != fgets(line, TRACEJSON_LINE_LENGTH, in_)) {
+    lineNo++;
+
+    if(('#' == line[0]) || ('\n' == line[0]) || ('\r' == line[0]) || ('\0' == line[0])) {
+      continue;
+    }
+
+    /* The width of %31s must be kept in step with TRACEJSON_NAME_LENGTH. */
+    if(2 == sscanf(line, "task %lu %31s", &id, name)) {
+      if(TRACEJSON_MAX_TASKS <= id) {
+        fprintf(stderr, "tracejson: bad task ID on line %lu\n", lineNo);
+
+        return(1);
+      }
+
+      strcpy(tasks[id].name, name);
+      tasks[id].named = 1;
+      continue;
+    }
+
+    if((3 != sscanf(line, "%lu %lu %lu", &time, &id, &event)) || (TRACEJSON_MAX_TASKS <= id) || (TraceEventTypes <= event)) {
+      fprintf(stderr, "tracejson: malformed event on line %lu\n", lineNo);
+
+      return(1);
+    }
+
+    last = time;
+
+    if(TraceEventDispatchStart == event) {
+      /* A start while the task is still open means the matching end was lost
+       * so close the slice before opening the next one. */
+      if(1 == tasks[id].open) {
+        emit(eventNames[event], "E", (double) time * scale_, id);
+      }
+
+      emit(eventNames[event], "B", (double) time * scale_, id);
+      tasks[id].open = 1;
+    } else if(TraceEventDispatchEnd == event) {
+      if(1 == tasks[id].open) {
+        emit(eventNames[event], "E", (double) time * scale_, id);
+        tasks[id].open = 0;
+      }
+    } else {
+      emit(eventNames[event], "i", (double) time * scale_, id);
+    }
+  }
+
+  /* Close any slice still open at the end of the capture so the viewer does
+   * not stretch it to infinity. */
+  for(id = 0; id < TRACEJSON_MAX_TASKS; id++) {
+    if(1 == tasks[id].open) {
+      emit(eventNames[TraceEventDispatchEnd], "E", (double) last * scale_, id);
+    }
+  }
+
+  for(id = 0; id < TRACEJSON_MAX_TASKS; id++) {
+    if(1 == tasks[id].named) {
+      printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}", (0 < events) ? ",\n" : "", id, tasks[id].name);
+      events++;
+    }
+  }
+
+  printf("\n]}\n");
+
+  if(0 == events) {
+    fprintf(stderr, "tracejson: no events\n");
+
+    return(1);
+  }
+
+  return(0);
+}
+
+
+static void emit(const char *name_, const char *phase_, const double ts_, const unsigned long id_) {
+  printf("%s{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":%lu%s}", (0 < events) ? ",\n" : "", name_, phase_, ts_, id_, (0 == strcmp("i",
+    phase_)) ? ",\"s\":\"t\"" : "");
+  events++;
+
+  return;
+}
+
+
+static void usage(void) {
+  fprintf(stderr, "usage: tracejson [-u microseconds per tick] [file]\n");
+
+  return;
+}